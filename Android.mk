@@ -55,15 +55,24 @@ LOCAL_SRC_FILES := \
     src/waffle/core/wcore_util.c \
     src/waffle/core/wcore_display.c \
     src/waffle/core/wcore_attrib_list.c \
+    src/waffle/core/wcore_capture.c \
+    src/waffle/core/wcore_config_cache.c \
+    src/waffle/core/wcore_config_rank.c \
+    src/waffle/core/wcore_symbol_cache.c \
     src/waffle/api/api_priv.c \
     src/waffle/api/waffle_attrib_list.c \
+    src/waffle/api/waffle_capture.c \
     src/waffle/api/waffle_config.c \
     src/waffle/api/waffle_context.c \
+    src/waffle/api/waffle_device.c \
     src/waffle/api/waffle_display.c \
     src/waffle/api/waffle_enum.c \
     src/waffle/api/waffle_error.c \
+    src/waffle/api/waffle_fence.c \
+    src/waffle/api/waffle_gl_dispatch.c \
     src/waffle/api/waffle_gl_misc.c \
     src/waffle/api/waffle_init.c \
+    src/waffle/api/waffle_readback.c \
     src/waffle/api/waffle_window.c \
     src/waffle/api/waffle_dl.c \
     src/waffle/linux/linux_dl.c \
@@ -71,6 +80,7 @@ LOCAL_SRC_FILES := \
     src/waffle/egl/wegl_config.c \
     src/waffle/egl/wegl_context.c \
     src/waffle/egl/wegl_display.c \
+    src/waffle/egl/wegl_fence.c \
     src/waffle/egl/wegl_util.c \
     src/waffle/egl/wegl_window.c \
     src/waffle/android/droid_platform.c \
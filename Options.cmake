@@ -4,6 +4,8 @@ if(waffle_on_linux)
     option(waffle_has_wayland "Build support for Wayland" OFF)
     option(waffle_has_x11_egl "Build support for X11/EGL" OFF)
     option(waffle_has_gbm "Build support for GBM" OFF)
+    option(waffle_has_surfaceless_egl "Build support for EGL_MESA_platform_surfaceless" OFF)
+    option(waffle_has_device_egl "Build support for EGL_EXT_platform_device" OFF)
 endif()
 
 option(waffle_build_tests "Build tests" ON)
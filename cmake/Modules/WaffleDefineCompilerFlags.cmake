@@ -79,3 +79,11 @@ endif()
 if(waffle_has_gbm)
     add_definitions(-DWAFFLE_HAS_GBM)
 endif()
+
+if(waffle_has_surfaceless_egl)
+    add_definitions(-DWAFFLE_HAS_SURFACELESS_EGL)
+endif()
+
+if(waffle_has_device_egl)
+    add_definitions(-DWAFFLE_HAS_DEVICE_EGL)
+endif()
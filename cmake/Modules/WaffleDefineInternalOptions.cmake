@@ -1,6 +1,7 @@
-if(waffle_has_wayland OR waffle_has_x11_egl OR waffle_has_gbm)
+if(waffle_has_wayland OR waffle_has_x11_egl OR waffle_has_gbm OR
+   waffle_has_surfaceless_egl OR waffle_has_device_egl)
     set(waffle_has_egl TRUE)
-else(waffle_has_wayland OR waffle_has_x11_egl)
+else()
     set(waffle_has_egl FALSE)
 endif()
 
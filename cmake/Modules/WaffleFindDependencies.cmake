@@ -49,6 +49,6 @@ if(waffle_has_x11)
 endif()
 
 if(waffle_has_gbm)
-    pkg_check_modules(gbm REQUIRED gbm)
+    pkg_check_modules(gbm REQUIRED gbm>=17.1)
     pkg_check_modules(libudev REQUIRED libudev)
 endif()
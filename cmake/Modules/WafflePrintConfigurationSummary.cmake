@@ -44,6 +44,12 @@ endif()
 if(waffle_has_gbm)
     message("    gbm")
 endif()
+if(waffle_has_surfaceless_egl)
+    message("    surfaceless_egl")
+endif()
+if(waffle_has_device_egl)
+    message("    device_egl")
+endif()
 message("")
 message("Dependencies:")
 if(waffle_has_egl)
@@ -46,11 +46,13 @@ endif()
 
 if(waffle_on_linux)
     if(NOT waffle_has_glx AND NOT waffle_has_wayland AND
-       NOT waffle_has_x11_egl AND NOT waffle_has_gbm)
+       NOT waffle_has_x11_egl AND NOT waffle_has_gbm AND
+       NOT waffle_has_surfaceless_egl AND NOT waffle_has_device_egl)
         message(FATAL_ERROR
                 "Must enable at least one of: "
                 "waffle_has_glx, waffle_has_wayland, "
-                "waffle_has_x11_egl, waffle_has_gbm.")
+                "waffle_has_x11_egl, waffle_has_gbm, "
+                "waffle_has_surfaceless_egl, waffle_has_device_egl.")
     endif()
 elseif(waffle_on_mac)
     if(waffle_has_gbm)
@@ -65,4 +67,10 @@ elseif(waffle_on_mac)
     if(waffle_has_x11_egl)
         message(FATAL_ERROR "Option is not supported on Darwin: waffle_has_x11_egl.")
     endif()
+    if(waffle_has_surfaceless_egl)
+        message(FATAL_ERROR "Option is not supported on Darwin: waffle_has_surfaceless_egl.")
+    endif()
+    if(waffle_has_device_egl)
+        message(FATAL_ERROR "Option is not supported on Darwin: waffle_has_device_egl.")
+    endif()
 endif()
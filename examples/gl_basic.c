@@ -57,7 +57,8 @@ removeXcodeArgs(int *argc, char **argv);
 
 static const char *usage_message =
     "usage:\n"
-    "    gl_basic --platform=android|cgl|gbm|glx|wayland|x11_egl\n"
+    "    gl_basic --platform=android|cgl|device_egl|gbm|glx|surfaceless_egl|\n"
+    "                        wayland|x11_egl\n"
     "             --api=gl|gles1|gles2|gles3\n"
     "             [--version=MAJOR.MINOR]\n"
     "             [--profile=core|compat|none]\n"
@@ -229,9 +230,11 @@ struct enum_map {
 
 static const struct enum_map platform_map[] = {
     {WAFFLE_PLATFORM_ANDROID,   "android"       },
+    {WAFFLE_PLATFORM_DEVICE_EGL, "device_egl"   },
     {WAFFLE_PLATFORM_CGL,       "cgl",          },
     {WAFFLE_PLATFORM_GBM,       "gbm"           },
     {WAFFLE_PLATFORM_GLX,       "glx"           },
+    {WAFFLE_PLATFORM_SURFACELESS_EGL, "surfaceless_egl" },
     {WAFFLE_PLATFORM_WAYLAND,   "wayland"       },
     {WAFFLE_PLATFORM_X11_EGL,   "x11_egl"       },
     {0,                         0               },
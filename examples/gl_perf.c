@@ -0,0 +1,951 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @file gl_perf.c
+/// @brief Measure the cost of common Waffle operations.
+///
+/// Each benchmark initializes Waffle with the requested platform, creates
+/// the objects it needs, and reports the rate of the operation under test.
+/// Use it to compare Waffle builds or platforms against one another.
+
+#define _POSIX_C_SOURCE 199309L // glibc feature macro for clock_gettime.
+#define WAFFLE_API_VERSION 0x0103
+#define WAFFLE_API_EXPERIMENTAL
+
+#include <getopt.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "waffle.h"
+
+static const char *usage_message =
+    "usage:\n"
+    "    gl_perf --platform=android|device_egl|gbm|glx|surfaceless_egl|\n"
+    "                       wayland|x11_egl\n"
+    "            --api=gl|gles1|gles2|gles3\n"
+    "            --bench=config|dlsym|draw|readback|swap\n"
+    "            [--iterations=N]\n"
+    "            [--swap-interval=N]\n"
+    "\n"
+    "examples:\n"
+    "    gl_perf --platform=wayland --api=gles2 --bench=swap\n"
+    "    gl_perf --platform=glx --api=gl --bench=swap --iterations=5000\n"
+    "    gl_perf --platform=x11_egl --api=gles2 --bench=config\n"
+    "    gl_perf --platform=x11_egl --api=gles2 --bench=swap --swap-interval=0\n"
+    "    gl_perf --platform=surfaceless_egl --api=gles2 --bench=draw\n"
+    "\n"
+    "benchmarks:\n"
+    "    config\n"
+    "        Call waffle_config_choose() with the same attributes on a fresh\n"
+    "        display (cold) and repeatedly on one display (warm). Report the\n"
+    "        mean time per call of each.\n"
+    "    draw\n"
+    "        Draw 256 triangles per frame, with one uniform update and one\n"
+    "        glDrawArrays() each, and swap in a loop, first with a default\n"
+    "        context and then with a WAFFLE_CONTEXT_NO_ERROR context. Report\n"
+    "        draws per second of each and the no-error speedup. Requires gl,\n"
+    "        gles2 or gles3.\n"
+        "    dlsym\n"
+    "        Resolve a list of OpenGL functions with one waffle_dl_sym() or\n"
+    "        waffle_get_proc_address() call per name, then with one\n"
+    "        waffle_dl_sym_array() or waffle_get_proc_address_array() call\n"
+    "        per list. Report the mean time per name of each.\n"
+    "    readback\n"
+    "        Clear the window, read its pixels and swap in a loop, first with\n"
+    "        a synchronous glReadPixels() and then with a triple-buffered\n"
+    "        waffle_readback. Report frames per second of each.\n"
+    "    swap\n"
+    "        Clear the window and call waffle_window_swap_buffers() in a\n"
+    "        loop. Report frames per second. With --swap-interval, set the\n"
+    "        window's swap interval first; 0 measures unthrottled swaps.\n"
+    ;
+
+enum {
+    OPT_PLATFORM = 1,
+    OPT_API,
+    OPT_BENCH,
+    OPT_ITERATIONS,
+    OPT_SWAP_INTERVAL,
+};
+
+static const struct option get_opts[] = {
+    { .name = "platform",       .has_arg = required_argument,     .val = OPT_PLATFORM },
+    { .name = "api",            .has_arg = required_argument,     .val = OPT_API },
+    { .name = "bench",          .has_arg = required_argument,     .val = OPT_BENCH },
+    { .name = "iterations",     .has_arg = required_argument,     .val = OPT_ITERATIONS },
+    { .name = "swap-interval",  .has_arg = required_argument,     .val = OPT_SWAP_INTERVAL },
+    { 0 },
+};
+
+/// @defgroup Error handlers
+/// @{
+///
+/// All error handlers exit.
+///
+
+static void __attribute__((noreturn))
+error_printf(const char *fmt, ...)
+{
+    va_list ap;
+
+    fflush(stdout);
+
+    va_start(ap, fmt);
+    fprintf(stderr, "gl_perf: error: ");
+    vfprintf(stderr, fmt, ap);
+    fprintf(stderr, "\n");
+    va_end(ap);
+
+    exit(EXIT_FAILURE);
+}
+
+static void __attribute__((noreturn))
+usage_error_printf(const char *fmt, ...)
+{
+    fflush(stdout);
+    fprintf(stderr, "gl_perf: usage error");
+
+    if (fmt) {
+        va_list ap;
+        va_start(ap, fmt);
+        fprintf(stderr, ": ");
+        vfprintf(stderr, fmt, ap);
+        va_end(ap);
+    }
+
+    fprintf(stderr, "\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, "%s", usage_message);
+
+    exit(EXIT_FAILURE);
+}
+
+static void __attribute__((noreturn))
+error_waffle(void)
+{
+    const struct waffle_error_info *info = waffle_error_get_info();
+    const char *code = waffle_error_to_string(info->code);
+
+    if (info->message_length > 0)
+        error_printf("%s: %s", code, info->message);
+    else
+        error_printf("%s", code);
+}
+
+/// @}
+/// @defgroup OpenGL declarations
+/// @{
+
+typedef float GLclampf;
+typedef float GLfloat;
+typedef unsigned char GLboolean;
+typedef unsigned int GLbitfield;
+typedef unsigned int GLenum;
+typedef unsigned int GLuint;
+typedef int GLint;
+typedef int GLsizei;
+typedef char GLchar;
+typedef void GLvoid;
+typedef intptr_t GLintptr;
+typedef intptr_t GLsizeiptr;
+
+enum {
+    // Copied from <GL/gl*.h>.
+    GL_TRIANGLES = 0x0004,
+    GL_UNSIGNED_BYTE = 0x00001401,
+    GL_FLOAT = 0x00001406,
+    GL_RGBA = 0x00001908,
+    GL_COLOR_BUFFER_BIT = 0x00004000,
+    GL_ARRAY_BUFFER = 0x8892,
+    GL_STATIC_DRAW = 0x88E4,
+    GL_FRAGMENT_SHADER = 0x8B30,
+    GL_VERTEX_SHADER = 0x8B31,
+    GL_COMPILE_STATUS = 0x8B81,
+    GL_LINK_STATUS = 0x8B82,
+};
+
+#define WINDOW_WIDTH  320
+#define WINDOW_HEIGHT 240
+
+static void (*glClearColor)(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha);
+static void (*glClear)(GLbitfield mask);
+static void (*glReadPixels)(GLint x, GLint y, GLsizei width, GLsizei height,
+                            GLenum format, GLenum type, GLvoid *data);
+
+// OpenGL 2.0 and OpenGL ES 2.0 functions, used only by bench_draw.
+static void (*glAttachShader)(GLuint program, GLuint shader);
+static void (*glBindAttribLocation)(GLuint program, GLuint index, const GLchar *name);
+static void (*glBindBuffer)(GLenum target, GLuint buffer);
+static void (*glBufferData)(GLenum target, GLsizeiptr size, const GLvoid *data, GLenum usage);
+static void (*glCompileShader)(GLuint shader);
+static GLuint (*glCreateProgram)(void);
+static GLuint (*glCreateShader)(GLenum type);
+static void (*glDeleteBuffers)(GLsizei n, const GLuint *buffers);
+static void (*glDeleteProgram)(GLuint program);
+static void (*glDeleteShader)(GLuint shader);
+static void (*glDrawArrays)(GLenum mode, GLint first, GLsizei count);
+static void (*glEnableVertexAttribArray)(GLuint index);
+static void (*glFinish)(void);
+static void (*glGenBuffers)(GLsizei n, GLuint *buffers);
+static void (*glGetProgramiv)(GLuint program, GLenum pname, GLint *params);
+static void (*glGetShaderiv)(GLuint shader, GLenum pname, GLint *params);
+static GLint (*glGetUniformLocation)(GLuint program, const GLchar *name);
+static void (*glLinkProgram)(GLuint program);
+static void (*glShaderSource)(GLuint shader, GLsizei count, const GLchar *const *string, const GLint *length);
+static void (*glUniform2f)(GLint location, GLfloat v0, GLfloat v1);
+static void (*glUseProgram)(GLuint program);
+static void (*glVertexAttribPointer)(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid *pointer);
+
+/// @}
+/// @defgroup Parsing Options
+/// @{
+
+struct options {
+    /// @brief One of `WAFFLE_PLATFORM_*`.
+    int platform;
+
+    /// @brief One of `WAFFLE_CONTEXT_OPENGL_*`.
+    int context_api;
+
+    /// @brief One of `WAFFLE_DL_*`.
+    int dl;
+
+    /// @brief Index into `benches`.
+    int bench;
+
+    int iterations;
+
+    /// @brief Passed to waffle_window_set_swap_interval() if
+    /// `has_swap_interval`.
+    bool has_swap_interval;
+    int swap_interval;
+};
+
+struct enum_map {
+    int i;
+    const char *s;
+};
+
+static const struct enum_map platform_map[] = {
+    {WAFFLE_PLATFORM_ANDROID,   "android"       },
+    {WAFFLE_PLATFORM_DEVICE_EGL, "device_egl"   },
+    {WAFFLE_PLATFORM_GBM,       "gbm"           },
+    {WAFFLE_PLATFORM_GLX,       "glx"           },
+    {WAFFLE_PLATFORM_SURFACELESS_EGL, "surfaceless_egl" },
+    {WAFFLE_PLATFORM_WAYLAND,   "wayland"       },
+    {WAFFLE_PLATFORM_X11_EGL,   "x11_egl"       },
+    {0,                         0               },
+};
+
+static const struct enum_map context_api_map[] = {
+    {WAFFLE_CONTEXT_OPENGL,         "gl"        },
+    {WAFFLE_CONTEXT_OPENGL_ES1,     "gles1"     },
+    {WAFFLE_CONTEXT_OPENGL_ES2,     "gles2"     },
+    {WAFFLE_CONTEXT_OPENGL_ES3,     "gles3"     },
+    {0,                             0           },
+};
+
+/// @brief Translate string to `enum waffle_enum`.
+///
+/// @param self is a list of map items. The last item must be zero-filled.
+/// @param result is altered only if @a s if found.
+/// @return true if @a s was found in @a map.
+static bool
+enum_map_translate_str(
+        const struct enum_map *self,
+        const char *s,
+        int *result)
+{
+    for (const struct enum_map *i = self; i->i != 0; ++i) {
+        if (!strncmp(s, i->s, strlen(i->s) + 1)) {
+            *result = i->i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// @}
+/// @defgroup Benchmarks
+/// @{
+
+struct bench_state {
+    const struct options *opts;
+    struct waffle_display *dpy;
+    struct waffle_config *config;
+    struct waffle_context *ctx;
+    struct waffle_window *window;
+
+    /// @brief Add WAFFLE_CONTEXT_NO_ERROR to the config attributes.
+    bool no_error;
+};
+
+static double
+get_time_sec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static void
+fill_config_attrib_list(const struct options *opts, bool no_error,
+                        int32_t config_attrib_list[])
+{
+    int i = 0;
+
+    config_attrib_list[i++] = WAFFLE_CONTEXT_API;
+    config_attrib_list[i++] = opts->context_api;
+    config_attrib_list[i++] = WAFFLE_RED_SIZE;
+    config_attrib_list[i++] = 8;
+    config_attrib_list[i++] = WAFFLE_GREEN_SIZE;
+    config_attrib_list[i++] = 8;
+    config_attrib_list[i++] = WAFFLE_BLUE_SIZE;
+    config_attrib_list[i++] = 8;
+    config_attrib_list[i++] = WAFFLE_DOUBLE_BUFFERED;
+    config_attrib_list[i++] = true;
+    if (no_error) {
+        config_attrib_list[i++] = WAFFLE_CONTEXT_NO_ERROR;
+        config_attrib_list[i++] = true;
+
+        // GL_KHR_no_error requires OpenGL 2.0. Both requests yield the
+        // latest compatible version, so the contexts remain comparable.
+        if (opts->context_api == WAFFLE_CONTEXT_OPENGL) {
+            config_attrib_list[i++] = WAFFLE_CONTEXT_MAJOR_VERSION;
+            config_attrib_list[i++] = 2;
+        }
+    }
+    config_attrib_list[i++] = 0;
+}
+
+/// @brief Connect a display, then create a config, context and window, and
+/// make them current.
+static void
+bench_setup_window(struct bench_state *state)
+{
+    int32_t config_attrib_list[64];
+
+    fill_config_attrib_list(state->opts, state->no_error, config_attrib_list);
+
+    state->dpy = waffle_display_connect(NULL);
+    if (!state->dpy)
+        error_waffle();
+
+    state->config = waffle_config_choose(state->dpy, config_attrib_list);
+    if (!state->config)
+        error_waffle();
+
+    state->ctx = waffle_context_create(state->config, NULL);
+    if (!state->ctx)
+        error_waffle();
+
+    state->window = waffle_window_create(state->config,
+                                         WINDOW_WIDTH, WINDOW_HEIGHT);
+    if (!state->window)
+        error_waffle();
+
+    if (!waffle_window_show(state->window))
+        error_waffle();
+
+    if (state->opts->has_swap_interval &&
+        !waffle_window_set_swap_interval(state->window,
+                                         state->opts->swap_interval))
+        error_waffle();
+
+    if (!waffle_make_current(state->dpy, state->window, state->ctx))
+        error_waffle();
+
+    glClear = waffle_dl_sym(state->opts->dl, "glClear");
+    glClearColor = waffle_dl_sym(state->opts->dl, "glClearColor");
+    glReadPixels = waffle_dl_sym(state->opts->dl, "glReadPixels");
+    if (!glClear || !glClearColor || !glReadPixels)
+        error_waffle();
+}
+
+static void
+bench_teardown_window(struct bench_state *state)
+{
+    if (!waffle_make_current(state->dpy, NULL, NULL))
+        error_waffle();
+
+    waffle_window_destroy(state->window);
+    waffle_context_destroy(state->ctx);
+    waffle_config_destroy(state->config);
+
+    if (!waffle_display_disconnect(state->dpy))
+        error_waffle();
+}
+
+static void
+bench_swap(struct bench_state *state)
+{
+    const int n = state->opts->iterations;
+    double start, elapsed;
+
+    bench_setup_window(state);
+
+    // Warm up, so that buffer allocation is not measured.
+    for (int i = 0; i < 3; ++i) {
+        glClear(GL_COLOR_BUFFER_BIT);
+        if (!waffle_window_swap_buffers(state->window))
+            error_waffle();
+    }
+
+    start = get_time_sec();
+    for (int i = 0; i < n; ++i) {
+        glClearColor((i & 1), 0, 0, 1);
+        glClear(GL_COLOR_BUFFER_BIT);
+        if (!waffle_window_swap_buffers(state->window))
+            error_waffle();
+    }
+    elapsed = get_time_sec() - start;
+
+    printf("swap: %d frames in %.3f s: %.1f frames/s\n",
+           n, elapsed, n / elapsed);
+
+    bench_teardown_window(state);
+}
+
+static void
+bench_readback(struct bench_state *state)
+{
+    enum { DEPTH = 3 };
+    const int n = state->opts->iterations;
+    static uint8_t pixels[4 * WINDOW_WIDTH * WINDOW_HEIGHT];
+    struct waffle_readback *readback;
+    double start, sync, async;
+
+    bench_setup_window(state);
+
+    start = get_time_sec();
+    for (int i = 0; i < n; ++i) {
+        glClearColor((i & 1), 0, 0, 1);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glReadPixels(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT,
+                     GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        if (!waffle_window_swap_buffers(state->window))
+            error_waffle();
+    }
+    sync = get_time_sec() - start;
+
+    readback = waffle_readback_create(state->ctx, WINDOW_WIDTH, WINDOW_HEIGHT,
+                                      GL_RGBA, DEPTH);
+    if (!readback)
+        error_waffle();
+
+    // Map each frame once DEPTH - 1 newer frames are queued behind it.
+    start = get_time_sec();
+    for (int i = 0; i < n; ++i) {
+        glClearColor((i & 1), 0, 0, 1);
+        glClear(GL_COLOR_BUFFER_BIT);
+        if (!waffle_readback_begin(readback, state->window))
+            error_waffle();
+        if (!waffle_window_swap_buffers(state->window))
+            error_waffle();
+
+        if (waffle_readback_get_num_pending(readback) == DEPTH) {
+            const void *data = waffle_readback_map_oldest(readback);
+            if (!data)
+                error_waffle();
+            memcpy(pixels, data, sizeof(pixels));
+            if (!waffle_readback_unmap(readback))
+                error_waffle();
+        }
+    }
+    while (waffle_readback_get_num_pending(readback) > 0) {
+        if (!waffle_readback_map_oldest(readback) ||
+            !waffle_readback_unmap(readback))
+            error_waffle();
+    }
+    async = get_time_sec() - start;
+
+    waffle_readback_destroy(readback);
+
+    printf("readback: glReadPixels: %d frames in %.3f s: %.1f frames/s\n",
+           n, sync, n / sync);
+    printf("readback: waffle_readback depth %d: %d frames in %.3f s: "
+           "%.1f frames/s\n", DEPTH, n, async, n / async);
+
+    bench_teardown_window(state);
+}
+
+static void
+bench_config(struct bench_state *state)
+{
+    const int n = state->opts->iterations;
+    const int n_cold = n / 10 + 1;
+    int32_t config_attrib_list[64];
+    double start, cold = 0, warm;
+
+    fill_config_attrib_list(state->opts, false, config_attrib_list);
+
+    // Each cold call needs its own display, because the display caches the
+    // configs chosen on it.
+    for (int i = 0; i < n_cold; ++i) {
+        state->dpy = waffle_display_connect(NULL);
+        if (!state->dpy)
+            error_waffle();
+
+        start = get_time_sec();
+        state->config = waffle_config_choose(state->dpy, config_attrib_list);
+        cold += get_time_sec() - start;
+
+        if (!state->config)
+            error_waffle();
+
+        waffle_config_destroy(state->config);
+        if (!waffle_display_disconnect(state->dpy))
+            error_waffle();
+    }
+
+    state->dpy = waffle_display_connect(NULL);
+    if (!state->dpy)
+        error_waffle();
+
+    // Prime the display's cache.
+    state->config = waffle_config_choose(state->dpy, config_attrib_list);
+    if (!state->config)
+        error_waffle();
+    waffle_config_destroy(state->config);
+
+    start = get_time_sec();
+    for (int i = 0; i < n; ++i) {
+        state->config = waffle_config_choose(state->dpy, config_attrib_list);
+        if (!state->config)
+            error_waffle();
+        waffle_config_destroy(state->config);
+    }
+    warm = get_time_sec() - start;
+
+    if (!waffle_display_disconnect(state->dpy))
+        error_waffle();
+
+    printf("config: cold: %d calls: %.2f us/call\n",
+           n_cold, 1e6 * cold / n_cold);
+    printf("config: warm: %d calls: %.2f us/call\n",
+           n, 1e6 * warm / n);
+}
+
+/// @brief Functions exported by the libraries of all WAFFLE_DL_* values.
+static const char *const dlsym_names[] = {
+    "glActiveTexture", "glBindBuffer", "glBindTexture", "glBlendFunc",
+    "glBufferData", "glBufferSubData", "glClear", "glClearColor",
+    "glClearStencil", "glColorMask", "glCompressedTexImage2D",
+    "glCopyTexImage2D", "glCopyTexSubImage2D", "glCullFace",
+    "glDeleteBuffers", "glDeleteTextures", "glDepthFunc", "glDepthMask",
+    "glDisable", "glDrawArrays", "glDrawElements", "glEnable", "glFinish",
+    "glFlush", "glFrontFace", "glGenBuffers", "glGenTextures",
+    "glGetBooleanv", "glGetBufferParameteriv", "glGetError", "glGetFloatv",
+    "glGetIntegerv", "glGetString", "glGetTexParameteriv", "glHint",
+    "glIsBuffer", "glIsEnabled", "glIsTexture", "glLineWidth",
+    "glPixelStorei", "glPolygonOffset", "glReadPixels", "glSampleCoverage",
+    "glScissor", "glStencilFunc", "glStencilMask", "glStencilOp",
+    "glTexImage2D", "glTexParameteri", "glTexSubImage2D", "glViewport",
+};
+
+enum {
+    NUM_DLSYM_NAMES = sizeof(dlsym_names) / sizeof(dlsym_names[0]),
+};
+
+static void
+bench_dlsym(struct bench_state *state)
+{
+    const int n = state->opts->iterations;
+    const int dl = state->opts->dl;
+    const double num_names = (double) n * NUM_DLSYM_NAMES;
+    void *syms[NUM_DLSYM_NAMES];
+    double start, dl_single, dl_array, gpa_single, gpa_array;
+
+    // Warm up, so that opening the library is not measured.
+    if (!waffle_dl_sym_array(dl, NUM_DLSYM_NAMES, dlsym_names, syms))
+        error_waffle();
+    waffle_get_proc_address_array(NUM_DLSYM_NAMES, dlsym_names, syms);
+
+    start = get_time_sec();
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < NUM_DLSYM_NAMES; ++j) {
+            syms[j] = waffle_dl_sym(dl, dlsym_names[j]);
+            if (!syms[j])
+                error_waffle();
+        }
+    }
+    dl_single = get_time_sec() - start;
+
+    start = get_time_sec();
+    for (int i = 0; i < n; ++i) {
+        if (!waffle_dl_sym_array(dl, NUM_DLSYM_NAMES, dlsym_names, syms))
+            error_waffle();
+    }
+    dl_array = get_time_sec() - start;
+
+    // Some platforms return null for functions that their OpenGL library
+    // exports statically, so failures are ignored here.
+    start = get_time_sec();
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < NUM_DLSYM_NAMES; ++j)
+            syms[j] = waffle_get_proc_address(dlsym_names[j]);
+    }
+    gpa_single = get_time_sec() - start;
+
+    start = get_time_sec();
+    for (int i = 0; i < n; ++i)
+        waffle_get_proc_address_array(NUM_DLSYM_NAMES, dlsym_names, syms);
+    gpa_array = get_time_sec() - start;
+
+    printf("dlsym: %d names x %d iterations\n", NUM_DLSYM_NAMES, n);
+    printf("dlsym: waffle_dl_sym:                 %.1f ns/name\n",
+           1e9 * dl_single / num_names);
+    printf("dlsym: waffle_dl_sym_array:           %.1f ns/name\n",
+           1e9 * dl_array / num_names);
+    printf("dlsym: waffle_get_proc_address:       %.1f ns/name\n",
+           1e9 * gpa_single / num_names);
+    printf("dlsym: waffle_get_proc_address_array: %.1f ns/name\n",
+           1e9 * gpa_array / num_names);
+}
+
+static const char *const draw_proc_names[] = {
+    "glAttachShader", "glBindAttribLocation", "glBindBuffer", "glBufferData",
+    "glCompileShader", "glCreateProgram", "glCreateShader", "glDeleteBuffers",
+    "glDeleteProgram", "glDeleteShader", "glDrawArrays",
+    "glEnableVertexAttribArray", "glFinish", "glGenBuffers", "glGetProgramiv",
+    "glGetShaderiv", "glGetUniformLocation", "glLinkProgram",
+    "glShaderSource", "glUniform2f", "glUseProgram", "glVertexAttribPointer",
+};
+
+enum {
+    NUM_DRAW_PROC_NAMES = sizeof(draw_proc_names) / sizeof(draw_proc_names[0]),
+};
+
+// Without a #version directive, the shaders are GLSL 1.10 on OpenGL and
+// GLSL ES 1.00 on OpenGL ES.
+static const char *draw_vs_source =
+    "attribute vec2 pos;\n"
+    "uniform vec2 offset;\n"
+    "void main() { gl_Position = vec4(pos + offset, 0.0, 1.0); }\n";
+
+static const char *draw_fs_source =
+    "#ifdef GL_ES\n"
+    "precision mediump float;\n"
+    "#endif\n"
+    "void main() { gl_FragColor = vec4(1.0); }\n";
+
+static GLuint
+draw_compile_shader(GLenum type, const char *source)
+{
+    GLuint shader = glCreateShader(type);
+    GLint ok;
+
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+    if (!ok)
+        error_printf("draw: failed to compile shader");
+
+    return shader;
+}
+
+/// @brief Draw `opts->iterations` frames of DRAWS_PER_FRAME triangles in
+/// the current context.
+///
+/// @return draw calls per second.
+static double
+draw_frames(struct bench_state *state)
+{
+    enum { DRAWS_PER_FRAME = 256 };
+    static const float vertices[] = { 0, 0,  0.02f, 0,  0, 0.02f };
+    const int n = state->opts->iterations;
+    void *procs[NUM_DRAW_PROC_NAMES];
+    GLuint vs, fs, program, buffer;
+    GLint ok, offset;
+    double start, elapsed;
+
+    waffle_get_proc_address_array(NUM_DRAW_PROC_NAMES, draw_proc_names, procs);
+    for (int i = 0; i < NUM_DRAW_PROC_NAMES; ++i) {
+        if (!procs[i])
+            error_printf("draw: failed to resolve %s", draw_proc_names[i]);
+    }
+
+    // Keep in the order of draw_proc_names.
+    glAttachShader = procs[0];
+    glBindAttribLocation = procs[1];
+    glBindBuffer = procs[2];
+    glBufferData = procs[3];
+    glCompileShader = procs[4];
+    glCreateProgram = procs[5];
+    glCreateShader = procs[6];
+    glDeleteBuffers = procs[7];
+    glDeleteProgram = procs[8];
+    glDeleteShader = procs[9];
+    glDrawArrays = procs[10];
+    glEnableVertexAttribArray = procs[11];
+    glFinish = procs[12];
+    glGenBuffers = procs[13];
+    glGetProgramiv = procs[14];
+    glGetShaderiv = procs[15];
+    glGetUniformLocation = procs[16];
+    glLinkProgram = procs[17];
+    glShaderSource = procs[18];
+    glUniform2f = procs[19];
+    glUseProgram = procs[20];
+    glVertexAttribPointer = procs[21];
+
+    vs = draw_compile_shader(GL_VERTEX_SHADER, draw_vs_source);
+    fs = draw_compile_shader(GL_FRAGMENT_SHADER, draw_fs_source);
+    program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glBindAttribLocation(program, 0, "pos");
+    glLinkProgram(program);
+    glGetProgramiv(program, GL_LINK_STATUS, &ok);
+    if (!ok)
+        error_printf("draw: failed to link program");
+    glUseProgram(program);
+    offset = glGetUniformLocation(program, "offset");
+
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, 0, 0, NULL);
+    glEnableVertexAttribArray(0);
+
+    start = get_time_sec();
+    for (int i = 0; i < n; ++i) {
+        glClear(GL_COLOR_BUFFER_BIT);
+        for (int j = 0; j < DRAWS_PER_FRAME; ++j) {
+            glUniform2f(offset, (j % 16) / 8.0f - 1.0f, (j / 16) / 8.0f - 1.0f);
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+        }
+        if (!waffle_window_swap_buffers(state->window))
+            error_waffle();
+    }
+    glFinish();
+    elapsed = get_time_sec() - start;
+
+    glDeleteBuffers(1, &buffer);
+    glDeleteProgram(program);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+
+    return (double) n * DRAWS_PER_FRAME / elapsed;
+}
+
+/// @brief Return true if the display accepts WAFFLE_CONTEXT_NO_ERROR.
+static bool
+draw_supports_no_error(const struct options *opts)
+{
+    int32_t config_attrib_list[64];
+    struct waffle_display *dpy;
+    struct waffle_config *config;
+
+    fill_config_attrib_list(opts, true, config_attrib_list);
+
+    dpy = waffle_display_connect(NULL);
+    if (!dpy)
+        error_waffle();
+
+    config = waffle_config_choose(dpy, config_attrib_list);
+    if (!config && waffle_error_get_code() != WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM)
+        error_waffle();
+    if (config)
+        waffle_config_destroy(config);
+
+    if (!waffle_display_disconnect(dpy))
+        error_waffle();
+
+    return config != NULL;
+}
+
+static void
+bench_draw(struct bench_state *state)
+{
+    double with_errors, no_error;
+
+    if (state->opts->context_api == WAFFLE_CONTEXT_OPENGL_ES1)
+        usage_error_printf("--bench=draw requires gl, gles2 or gles3");
+
+    bench_setup_window(state);
+    with_errors = draw_frames(state);
+    bench_teardown_window(state);
+
+    printf("draw: default context: %.0f draws/s\n", with_errors);
+
+    if (!draw_supports_no_error(state->opts)) {
+        printf("draw: no-error context: unsupported\n");
+        return;
+    }
+
+    state->no_error = true;
+    bench_setup_window(state);
+    no_error = draw_frames(state);
+    bench_teardown_window(state);
+
+    printf("draw: no-error context: %.0f draws/s (%+.1f%%)\n",
+           no_error, 100.0 * (no_error - with_errors) / with_errors);
+}
+
+struct bench {
+    const char *name;
+    void (*func)(struct bench_state *state);
+};
+
+static const struct bench benches[] = {
+    { "config",         bench_config            },
+    { "dlsym",          bench_dlsym             },
+    { "draw",           bench_draw              },
+    { "readback",       bench_readback          },
+    { "swap",           bench_swap              },
+    { 0,                0                       },
+};
+
+/// @}
+
+/// @return true on success.
+static bool
+parse_args(int argc, char *argv[], struct options *opts)
+{
+    bool ok;
+    bool loop_get_opt = true;
+
+    opts->bench = -1;
+    opts->iterations = 1000;
+
+    while (loop_get_opt) {
+        int opt = getopt_long(argc, argv, "", get_opts, NULL);
+        switch (opt) {
+            case -1:
+                loop_get_opt = false;
+                break;
+            case '?':
+                goto error_unrecognized_arg;
+            case OPT_PLATFORM:
+                ok = enum_map_translate_str(platform_map, optarg,
+                                            &opts->platform);
+                if (!ok) {
+                    usage_error_printf("'%s' is not a valid platform",
+                                       optarg);
+                }
+                break;
+            case OPT_API:
+                ok = enum_map_translate_str(context_api_map, optarg,
+                                            &opts->context_api);
+                if (!ok) {
+                    usage_error_printf("'%s' is not a valid API for an OpenGL "
+                                       "context", optarg);
+                }
+                break;
+            case OPT_BENCH:
+                for (int i = 0; benches[i].name; ++i) {
+                    if (strcmp(optarg, benches[i].name) == 0) {
+                        opts->bench = i;
+                        break;
+                    }
+                }
+                if (opts->bench == -1) {
+                    usage_error_printf("'%s' is not a valid benchmark",
+                                       optarg);
+                }
+                break;
+            case OPT_ITERATIONS:
+                opts->iterations = atoi(optarg);
+                if (opts->iterations <= 0) {
+                    usage_error_printf("'%s' is not a valid iteration count",
+                                       optarg);
+                }
+                break;
+            case OPT_SWAP_INTERVAL:
+                opts->has_swap_interval = true;
+                opts->swap_interval = atoi(optarg);
+                break;
+            default:
+                abort();
+                loop_get_opt = false;
+                break;
+        }
+    }
+
+    if (optind < argc) {
+        goto error_unrecognized_arg;
+    }
+
+    if (!opts->platform) {
+        usage_error_printf("--platform is required");
+    }
+
+    if (!opts->context_api) {
+        usage_error_printf("--api is required");
+    }
+
+    if (opts->bench == -1) {
+        usage_error_printf("--bench is required");
+    }
+
+    // Set dl.
+    switch (opts->context_api) {
+        case WAFFLE_CONTEXT_OPENGL:     opts->dl = WAFFLE_DL_OPENGL;      break;
+        case WAFFLE_CONTEXT_OPENGL_ES1: opts->dl = WAFFLE_DL_OPENGL_ES1;  break;
+        case WAFFLE_CONTEXT_OPENGL_ES2: opts->dl = WAFFLE_DL_OPENGL_ES2;  break;
+        case WAFFLE_CONTEXT_OPENGL_ES3: opts->dl = WAFFLE_DL_OPENGL_ES3;  break;
+        default:
+            abort();
+            break;
+    }
+
+    return true;
+
+error_unrecognized_arg:
+    usage_error_printf("unrecognized option '%s'", optarg);
+}
+
+int
+main(int argc, char **argv)
+{
+    struct options opts = {0};
+    struct bench_state state = {0};
+    int32_t init_attrib_list[3];
+    int i;
+
+    if (!parse_args(argc, argv, &opts))
+        exit(EXIT_FAILURE);
+
+    i = 0;
+    init_attrib_list[i++] = WAFFLE_PLATFORM;
+    init_attrib_list[i++] = opts.platform;
+    init_attrib_list[i++] = WAFFLE_NONE;
+
+    if (!waffle_init(init_attrib_list))
+        error_waffle();
+
+    state.opts = &opts;
+    benches[opts.bench].func(&state);
+
+    return EXIT_SUCCESS;
+}
@@ -121,6 +121,8 @@ enum waffle_enum {
         WAFFLE_PLATFORM_WAYLAND                                 = 0x0014,
         WAFFLE_PLATFORM_X11_EGL                                 = 0x0015,
         WAFFLE_PLATFORM_GBM                                     = 0x0016,
+        WAFFLE_PLATFORM_SURFACELESS_EGL                         = 0x0018,
+        WAFFLE_PLATFORM_DEVICE_EGL                              = 0x0019,
 
     // ------------------------------------------------------------------
     // For waffle_config_choose()
@@ -142,6 +144,18 @@ enum waffle_enum {
 #if WAFFLE_API_VERSION >= 0x0103
     WAFFLE_CONTEXT_FORWARD_COMPATIBLE                           = 0x0215,
     WAFFLE_CONTEXT_DEBUG                                        = 0x0216,
+    WAFFLE_CONTEXT_NO_ERROR                                     = 0x021b,
+
+    WAFFLE_CONTEXT_RELEASE_BEHAVIOR                             = 0x021c,
+        WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE                    = 0x021d,
+        WAFFLE_CONTEXT_RELEASE_BEHAVIOR_FLUSH                   = 0x021e,
+
+    WAFFLE_CONTEXT_PRIORITY                                     = 0x021f,
+        WAFFLE_CONTEXT_PRIORITY_HIGH                            = 0x0220,
+        WAFFLE_CONTEXT_PRIORITY_MEDIUM                          = 0x0221,
+        WAFFLE_CONTEXT_PRIORITY_LOW                             = 0x0222,
+
+    WAFFLE_CONTEXT_NO_CONFIG                                    = 0x0224,
 #endif
 
     WAFFLE_RED_SIZE                                             = 0x0201,
@@ -159,6 +173,19 @@ enum waffle_enum {
 
     WAFFLE_ACCUM_BUFFER                                         = 0x0213,
 
+#if WAFFLE_API_VERSION >= 0x0103
+    WAFFLE_COLOR_FORMAT                                         = 0x0217,
+        WAFFLE_COLOR_FORMAT_RGB565                              = 0x0218,
+        WAFFLE_COLOR_FORMAT_RGB10_A2                            = 0x0219,
+        WAFFLE_COLOR_FORMAT_RGBA16F                             = 0x021a,
+
+    WAFFLE_MUTABLE_RENDER_BUFFER                                = 0x0223,
+
+    WAFFLE_CONFIG_SELECTION                                     = 0x0225,
+        WAFFLE_CONFIG_SELECTION_SPEC_ORDER                      = 0x0226,
+        WAFFLE_CONFIG_SELECTION_SMALLEST                        = 0x0227,
+#endif
+
     // ------------------------------------------------------------------
     // For waffle_dl_sym()
     // ------------------------------------------------------------------
@@ -167,6 +194,37 @@ enum waffle_enum {
     WAFFLE_DL_OPENGL_ES1                                        = 0x0302,
     WAFFLE_DL_OPENGL_ES2                                        = 0x0303,
     WAFFLE_DL_OPENGL_ES3                                        = 0x0304,
+
+#if WAFFLE_API_VERSION >= 0x0103
+    // ------------------------------------------------------------------
+    // For waffle_window_attach_capture()
+    // ------------------------------------------------------------------
+
+    WAFFLE_CAPTURE_FD                                           = 0x0401,
+
+    WAFFLE_CAPTURE_SINK                                         = 0x0402,
+        WAFFLE_CAPTURE_SINK_STREAM                              = 0x0403,
+        WAFFLE_CAPTURE_SINK_SHM_RING                            = 0x0404,
+
+    WAFFLE_CAPTURE_FORMAT                                       = 0x0405,
+        WAFFLE_CAPTURE_FORMAT_RAW                               = 0x0406,
+        WAFFLE_CAPTURE_FORMAT_Y4M                               = 0x0407,
+
+    WAFFLE_CAPTURE_POLICY                                       = 0x0408,
+        WAFFLE_CAPTURE_POLICY_BLOCK                             = 0x0409,
+        WAFFLE_CAPTURE_POLICY_DROP                              = 0x040a,
+
+    WAFFLE_CAPTURE_QUEUE_DEPTH                                  = 0x040b,
+    WAFFLE_CAPTURE_RING_SLOTS                                   = 0x040c,
+    WAFFLE_CAPTURE_FRAME_RATE                                   = 0x040d,
+
+    // ------------------------------------------------------------------
+    // For waffle_window_set_render_buffer()
+    // ------------------------------------------------------------------
+
+    WAFFLE_RENDER_BUFFER_BACK                                   = 0x0501,
+    WAFFLE_RENDER_BUFFER_SINGLE                                 = 0x0502,
+#endif
 };
 
 WAFFLE_API const char*
@@ -182,13 +240,54 @@ waffle_make_current(struct waffle_display *dpy,
                     struct waffle_window *window,
                     struct waffle_context *ctx);
 
+#if defined(WAFFLE_API_EXPERIMENTAL) && WAFFLE_API_VERSION >= 0x0103
+WAFFLE_API struct waffle_display*
+waffle_get_current_display(void);
+
+WAFFLE_API struct waffle_window*
+waffle_get_current_window(void);
+
+WAFFLE_API struct waffle_context*
+waffle_get_current_context(void);
+#endif
+
 WAFFLE_API void*
 waffle_get_proc_address(const char *name);
 
+#if defined(WAFFLE_API_EXPERIMENTAL) && WAFFLE_API_VERSION >= 0x0103
+WAFFLE_API bool
+waffle_get_proc_address_array(int32_t count,
+                              const char *const names[],
+                              void *procs[]);
+#endif
+
 WAFFLE_API bool
 waffle_is_extension_in_string(const char *restrict extension_string,
                               const char *restrict extension_name);
 
+// ---------------------------------------------------------------------------
+// waffle_device
+// ---------------------------------------------------------------------------
+
+#if defined(WAFFLE_API_EXPERIMENTAL) && WAFFLE_API_VERSION >= 0x0103
+struct waffle_device_info {
+    /// Pass this, formatted as a decimal string, to waffle_display_connect().
+    int32_t index;
+
+    /// Each string is null if the device does not provide it.
+    const char *driver_name;
+    const char *drm_device_file;
+    const char *drm_render_node_file;
+    const char *extensions;
+};
+
+WAFFLE_API int32_t
+waffle_device_count(void);
+
+WAFFLE_API const struct waffle_device_info*
+waffle_device_get_info(int32_t index);
+#endif
+
 // ---------------------------------------------------------------------------
 // waffle_display
 // ---------------------------------------------------------------------------
@@ -220,6 +319,14 @@ waffle_config_destroy(struct waffle_config *self);
 WAFFLE_API union waffle_native_config*
 waffle_config_get_native(struct waffle_config *self);
 
+#if defined(WAFFLE_API_EXPERIMENTAL) && WAFFLE_API_VERSION >= 0x0103
+WAFFLE_API bool
+waffle_config_get_attrib(
+        struct waffle_config *self,
+        int32_t attrib,
+        int32_t *value);
+#endif
+
 // ---------------------------------------------------------------------------
 // waffle_context
 // ---------------------------------------------------------------------------
@@ -234,6 +341,13 @@ waffle_context_destroy(struct waffle_context *self);
 WAFFLE_API union waffle_native_context*
 waffle_context_get_native(struct waffle_context *self);
 
+#if defined(WAFFLE_API_EXPERIMENTAL) && WAFFLE_API_VERSION >= 0x0103
+WAFFLE_API bool
+waffle_context_get_priority(
+        struct waffle_context *self,
+        int32_t *priority);
+#endif
+
 // ---------------------------------------------------------------------------
 // waffle_window
 // ---------------------------------------------------------------------------
@@ -257,11 +371,218 @@ WAFFLE_API union waffle_native_window*
 waffle_window_get_native(struct waffle_window *self);
 
 #if defined(WAFFLE_API_EXPERIMENTAL) && WAFFLE_API_VERSION >= 0x0103
+WAFFLE_API struct waffle_window*
+waffle_window_create_with_modifiers(
+        struct waffle_config *config,
+        int32_t width,
+        int32_t height,
+        const uint64_t *modifiers,
+        int32_t num_modifiers);
+
 WAFFLE_API bool
 waffle_window_resize(
         struct waffle_window *self,
         int32_t width,
         int32_t height);
+
+WAFFLE_API bool
+waffle_window_swap_buffers_with_damage(
+        struct waffle_window *self,
+        const int32_t *rects,
+        int32_t n_rects);
+
+WAFFLE_API bool
+waffle_window_get_buffer_age(
+        struct waffle_window *self,
+        int32_t *age);
+
+WAFFLE_API bool
+waffle_window_set_damage_region(
+        struct waffle_window *self,
+        const int32_t *rects,
+        int32_t n_rects);
+
+/// @a buffer is WAFFLE_RENDER_BUFFER_BACK or WAFFLE_RENDER_BUFFER_SINGLE.
+/// The window's config must have WAFFLE_MUTABLE_RENDER_BUFFER.
+WAFFLE_API bool
+waffle_window_set_render_buffer(
+        struct waffle_window *self,
+        int32_t buffer);
+
+/// Called with each buffer posted by a swap of a window that has a front
+/// buffer callback. The buffer is a struct gbm_bo* on GBM.
+typedef void (*waffle_front_buffer_func)(struct waffle_window *window,
+                                         void *buffer,
+                                         void *user_data);
+
+WAFFLE_API bool
+waffle_window_set_front_buffer_callback(
+        struct waffle_window *self,
+        waffle_front_buffer_func func,
+        void *user_data);
+
+WAFFLE_API bool
+waffle_window_release_front_buffer(
+        struct waffle_window *self,
+        void *buffer);
+
+#define WAFFLE_DMABUF_MAX_PLANES 4
+
+/// A buffer exported with waffle_window_export_dmabuf(). The caller owns
+/// the file descriptors and must close them.
+struct waffle_dmabuf {
+    int32_t width;
+    int32_t height;
+
+    /// A DRM_FORMAT_* fourcc code.
+    uint32_t fourcc;
+
+    /// A DRM_FORMAT_MOD_* format modifier.
+    uint64_t modifier;
+
+    int32_t num_planes;
+    int32_t fds[WAFFLE_DMABUF_MAX_PLANES];
+    uint32_t strides[WAFFLE_DMABUF_MAX_PLANES];
+    uint32_t offsets[WAFFLE_DMABUF_MAX_PLANES];
+};
+
+WAFFLE_API bool
+waffle_window_export_dmabuf(
+        struct waffle_window *self,
+        struct waffle_dmabuf *dmabuf);
+
+WAFFLE_API bool
+waffle_window_set_swap_interval(
+        struct waffle_window *self,
+        int32_t interval);
+#endif
+
+// ---------------------------------------------------------------------------
+// waffle_readback
+// ---------------------------------------------------------------------------
+
+#if defined(WAFFLE_API_EXPERIMENTAL) && WAFFLE_API_VERSION >= 0x0103
+#define WAFFLE_READBACK_MAX_DEPTH 8
+
+/// A ring of pixel pack buffers that reads a window's pixels without
+/// stalling on the GPU. Use it only while its context is current.
+struct waffle_readback;
+
+WAFFLE_API struct waffle_readback*
+waffle_readback_create(
+        struct waffle_context *ctx,
+        int32_t width,
+        int32_t height,
+        int32_t format,
+        int32_t depth);
+
+WAFFLE_API bool
+waffle_readback_destroy(struct waffle_readback *self);
+
+WAFFLE_API bool
+waffle_readback_begin(
+        struct waffle_readback *self,
+        struct waffle_window *window);
+
+WAFFLE_API int32_t
+waffle_readback_get_num_pending(struct waffle_readback *self);
+
+WAFFLE_API const void*
+waffle_readback_map_oldest(struct waffle_readback *self);
+
+WAFFLE_API bool
+waffle_readback_unmap(struct waffle_readback *self);
+#endif
+
+// ---------------------------------------------------------------------------
+// waffle_capture
+// ---------------------------------------------------------------------------
+
+#if defined(WAFFLE_API_EXPERIMENTAL) && WAFFLE_API_VERSION >= 0x0103
+/// A sink that receives the frame of each swap of a window and writes it
+/// from a background thread.
+struct waffle_capture;
+
+struct waffle_capture_stats {
+    /// Frames queued for the writer, including the one being written.
+    int32_t queue_depth;
+    int32_t max_queue_depth;
+
+    uint64_t frames_captured;
+    uint64_t frames_written;
+    uint64_t frames_dropped;
+
+    /// The waffle_error of the last frame that could not be captured, or
+    /// WAFFLE_NO_ERROR. Capture failures never fail the swap.
+    int32_t last_error;
+
+    /// The errno of the first failed write, or 0. Later frames are dropped.
+    int32_t write_error;
+};
+
+#define WAFFLE_CAPTURE_RING_MAGIC 0x52434657 // "WFCR"
+
+/// The start of a WAFFLE_CAPTURE_SINK_SHM_RING mapping.
+///
+/// Slot i starts at byte slot_offset + i * slot_size of the mapping. It
+/// begins with the uint64_t number of the frame it holds, and its pixels
+/// start 64 bytes in, as top-down RGBA rows of stride bytes. Frame n,
+/// counting from 1, goes to slot (n - 1) % num_slots. A reader that finds
+/// the slot's frame number unchanged after copying has an intact frame.
+struct waffle_capture_ring {
+    uint32_t magic;
+    uint32_t num_slots;
+    int32_t width;
+    int32_t height;
+    uint32_t stride;
+    uint32_t slot_offset;
+    uint32_t slot_size;
+    uint32_t reserved;
+    uint64_t frames_written;
+};
+
+WAFFLE_API struct waffle_capture*
+waffle_window_attach_capture(
+        struct waffle_window *self,
+        const int32_t attrib_list[]);
+
+WAFFLE_API bool
+waffle_capture_detach(struct waffle_capture *self);
+
+WAFFLE_API bool
+waffle_capture_get_stats(
+        struct waffle_capture *self,
+        struct waffle_capture_stats *stats);
+#endif
+
+// ---------------------------------------------------------------------------
+// waffle_fence
+// ---------------------------------------------------------------------------
+
+#if defined(WAFFLE_API_EXPERIMENTAL) && WAFFLE_API_VERSION >= 0x0103
+/// A point in a context's command stream that the CPU can wait for.
+struct waffle_fence;
+
+#define WAFFLE_FENCE_WAIT_FOREVER UINT64_MAX
+
+WAFFLE_API struct waffle_fence*
+waffle_fence_create(struct waffle_context *ctx);
+
+WAFFLE_API bool
+waffle_fence_destroy(struct waffle_fence *self);
+
+/// Return true if the fence signaled within @a timeout_ns. On timeout,
+/// return false without emitting an error.
+WAFFLE_API bool
+waffle_fence_wait(struct waffle_fence *self, uint64_t timeout_ns);
+
+/// Like waffle_fence_wait() with a timeout of 0.
+WAFFLE_API bool
+waffle_fence_is_signaled(struct waffle_fence *self);
+
+/// Return a new sync file descriptor for the fence, or -1.
+WAFFLE_API int
+waffle_fence_export_fd(struct waffle_fence *self);
 #endif
 
 // ---------------------------------------------------------------------------
@@ -274,10 +595,38 @@ waffle_dl_can_open(int32_t dl);
 WAFFLE_API void*
 waffle_dl_sym(int32_t dl, const char *name);
 
+#if defined(WAFFLE_API_EXPERIMENTAL) && WAFFLE_API_VERSION >= 0x0103
+WAFFLE_API bool
+waffle_dl_sym_array(int32_t dl,
+                    int32_t count,
+                    const char *const names[],
+                    void *syms[]);
+
+struct waffle_symbol_cache_stats {
+    /// Lookups answered by the cache.
+    uint64_t hits;
+
+    /// Lookups that reached dlsym() or the driver.
+    uint64_t misses;
+
+    /// Symbols the cache holds. Names that failed to resolve are not cached.
+    uint64_t num_symbols;
+};
+
+/// Fill @a stats with the counters of the cache behind waffle_dl_sym() and
+/// waffle_get_proc_address().
+WAFFLE_API bool
+waffle_get_symbol_cache_stats(struct waffle_symbol_cache_stats *stats);
+#endif
+
 // ---------------------------------------------------------------------------
 // waffle_native
 // ---------------------------------------------------------------------------
 
+struct waffle_device_egl_config;
+struct waffle_device_egl_context;
+struct waffle_device_egl_display;
+struct waffle_device_egl_window;
 struct waffle_gbm_config;
 struct waffle_gbm_context;
 struct waffle_gbm_display;
@@ -286,6 +635,10 @@ struct waffle_glx_config;
 struct waffle_glx_context;
 struct waffle_glx_display;
 struct waffle_glx_window;
+struct waffle_surfaceless_egl_config;
+struct waffle_surfaceless_egl_context;
+struct waffle_surfaceless_egl_display;
+struct waffle_surfaceless_egl_window;
 struct waffle_wayland_config;
 struct waffle_wayland_context;
 struct waffle_wayland_display;
@@ -300,6 +653,8 @@ union waffle_native_display {
     struct waffle_glx_display *glx;
     struct waffle_x11_egl_display *x11_egl;
     struct waffle_wayland_display *wayland;
+    struct waffle_surfaceless_egl_display *surfaceless_egl;
+    struct waffle_device_egl_display *device_egl;
 };
 
 union waffle_native_config {
@@ -307,6 +662,8 @@ union waffle_native_config {
     struct waffle_glx_config *glx;
     struct waffle_x11_egl_config *x11_egl;
     struct waffle_wayland_config *wayland;
+    struct waffle_surfaceless_egl_config *surfaceless_egl;
+    struct waffle_device_egl_config *device_egl;
 };
 
 union waffle_native_context {
@@ -314,6 +671,8 @@ union waffle_native_context {
     struct waffle_glx_context *glx;
     struct waffle_x11_egl_context *x11_egl;
     struct waffle_wayland_context *wayland;
+    struct waffle_surfaceless_egl_context *surfaceless_egl;
+    struct waffle_device_egl_context *device_egl;
 };
 
 union waffle_native_window {
@@ -321,6 +680,8 @@ union waffle_native_window {
     struct waffle_glx_window *glx;
     struct waffle_x11_egl_window *x11_egl;
     struct waffle_wayland_window *wayland;
+    struct waffle_surfaceless_egl_window *surfaceless_egl;
+    struct waffle_device_egl_window *device_egl;
 };
 
 // ---------------------------------------------------------------------------
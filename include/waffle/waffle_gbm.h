@@ -58,6 +58,10 @@ struct waffle_gbm_window {
     struct waffle_gbm_display display;
     struct gbm_surface *gbm_surface;
     EGLSurface egl_surface;
+
+    /// The format modifier of the buffer posted by the last swap, or
+    /// DRM_FORMAT_MOD_INVALID if the window has not swapped yet.
+    uint64_t modifier;
 };
 
 #ifdef __cplusplus
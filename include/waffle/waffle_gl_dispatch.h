@@ -0,0 +1,152 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @file
+/// @brief A lazily bound table of OpenGL functions.
+///
+/// Each context owns one table, returned by
+/// waffle_context_get_gl_dispatch(). Every entry starts as a trampoline.
+/// The first call through an entry resolves the function for the API of the
+/// context that is current on the calling thread, stores it in the current
+/// context's table, and forwards the call. Later calls go straight to the
+/// driver. Call through a table only while its context is current.
+///
+/// The parameter types below are the C types that `<GL/gl.h>` and
+/// `<GLES2/gl2.h>` use for GLenum, GLint, GLfloat and so on, which lets
+/// this header be included with or without the GL headers.
+
+#pragma once
+
+#include <stddef.h>
+
+#include "waffle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(WAFFLE_API_EXPERIMENTAL) && WAFFLE_API_VERSION >= 0x0103
+
+/// @brief The functions in `struct waffle_gl_dispatch`.
+///
+/// Expand this with two macros. `FUNC(ret, name, params, args)` receives
+/// the functions that return a value, and `PROC(name, params, args)`
+/// receives the functions that return void.
+#define WAFFLE_GL_DISPATCH_FUNCTIONS(FUNC, PROC) \
+    PROC(glActiveTexture, (unsigned int texture), (texture)) \
+    PROC(glAttachShader, (unsigned int program, unsigned int shader), (program, shader)) \
+    PROC(glBindAttribLocation, (unsigned int program, unsigned int index, const char *name), (program, index, name)) \
+    PROC(glBindBuffer, (unsigned int target, unsigned int buffer), (target, buffer)) \
+    PROC(glBindFramebuffer, (unsigned int target, unsigned int framebuffer), (target, framebuffer)) \
+    PROC(glBindTexture, (unsigned int target, unsigned int texture), (target, texture)) \
+    PROC(glBlendFunc, (unsigned int sfactor, unsigned int dfactor), (sfactor, dfactor)) \
+    PROC(glBufferData, (unsigned int target, ptrdiff_t size, const void *data, unsigned int usage), (target, size, data, usage)) \
+    PROC(glBufferSubData, (unsigned int target, ptrdiff_t offset, ptrdiff_t size, const void *data), (target, offset, size, data)) \
+    FUNC(unsigned int, glCheckFramebufferStatus, (unsigned int target), (target)) \
+    PROC(glClear, (unsigned int mask), (mask)) \
+    PROC(glClearColor, (float red, float green, float blue, float alpha), (red, green, blue, alpha)) \
+    PROC(glClearStencil, (int s), (s)) \
+    PROC(glColorMask, (unsigned char red, unsigned char green, unsigned char blue, unsigned char alpha), (red, green, blue, alpha)) \
+    PROC(glCompileShader, (unsigned int shader), (shader)) \
+    FUNC(unsigned int, glCreateProgram, (void), ()) \
+    FUNC(unsigned int, glCreateShader, (unsigned int type), (type)) \
+    PROC(glCullFace, (unsigned int mode), (mode)) \
+    PROC(glDeleteBuffers, (int n, const unsigned int *buffers), (n, buffers)) \
+    PROC(glDeleteFramebuffers, (int n, const unsigned int *framebuffers), (n, framebuffers)) \
+    PROC(glDeleteProgram, (unsigned int program), (program)) \
+    PROC(glDeleteShader, (unsigned int shader), (shader)) \
+    PROC(glDeleteTextures, (int n, const unsigned int *textures), (n, textures)) \
+    PROC(glDepthFunc, (unsigned int func), (func)) \
+    PROC(glDepthMask, (unsigned char flag), (flag)) \
+    PROC(glDisable, (unsigned int cap), (cap)) \
+    PROC(glDisableVertexAttribArray, (unsigned int index), (index)) \
+    PROC(glDrawArrays, (unsigned int mode, int first, int count), (mode, first, count)) \
+    PROC(glDrawElements, (unsigned int mode, int count, unsigned int type, const void *indices), (mode, count, type, indices)) \
+    PROC(glEnable, (unsigned int cap), (cap)) \
+    PROC(glEnableVertexAttribArray, (unsigned int index), (index)) \
+    PROC(glFinish, (void), ()) \
+    PROC(glFlush, (void), ()) \
+    PROC(glFramebufferTexture2D, (unsigned int target, unsigned int attachment, unsigned int textarget, unsigned int texture, int level), (target, attachment, textarget, texture, level)) \
+    PROC(glFrontFace, (unsigned int mode), (mode)) \
+    PROC(glGenBuffers, (int n, unsigned int *buffers), (n, buffers)) \
+    PROC(glGenFramebuffers, (int n, unsigned int *framebuffers), (n, framebuffers)) \
+    PROC(glGenTextures, (int n, unsigned int *textures), (n, textures)) \
+    FUNC(int, glGetAttribLocation, (unsigned int program, const char *name), (program, name)) \
+    PROC(glGetBooleanv, (unsigned int pname, unsigned char *data), (pname, data)) \
+    FUNC(unsigned int, glGetError, (void), ()) \
+    PROC(glGetFloatv, (unsigned int pname, float *data), (pname, data)) \
+    PROC(glGetIntegerv, (unsigned int pname, int *data), (pname, data)) \
+    PROC(glGetProgramInfoLog, (unsigned int program, int bufSize, int *length, char *infoLog), (program, bufSize, length, infoLog)) \
+    PROC(glGetProgramiv, (unsigned int program, unsigned int pname, int *params), (program, pname, params)) \
+    PROC(glGetShaderInfoLog, (unsigned int shader, int bufSize, int *length, char *infoLog), (shader, bufSize, length, infoLog)) \
+    PROC(glGetShaderiv, (unsigned int shader, unsigned int pname, int *params), (shader, pname, params)) \
+    FUNC(const unsigned char*, glGetString, (unsigned int name), (name)) \
+    FUNC(const unsigned char*, glGetStringi, (unsigned int name, unsigned int index), (name, index)) \
+    FUNC(int, glGetUniformLocation, (unsigned int program, const char *name), (program, name)) \
+    PROC(glHint, (unsigned int target, unsigned int mode), (target, mode)) \
+    FUNC(unsigned char, glIsEnabled, (unsigned int cap), (cap)) \
+    PROC(glLineWidth, (float width), (width)) \
+    PROC(glLinkProgram, (unsigned int program), (program)) \
+    PROC(glPixelStorei, (unsigned int pname, int param), (pname, param)) \
+    PROC(glPolygonOffset, (float factor, float units), (factor, units)) \
+    PROC(glReadPixels, (int x, int y, int width, int height, unsigned int format, unsigned int type, void *pixels), (x, y, width, height, format, type, pixels)) \
+    PROC(glScissor, (int x, int y, int width, int height), (x, y, width, height)) \
+    PROC(glShaderSource, (unsigned int shader, int count, const char *const *string, const int *length), (shader, count, string, length)) \
+    PROC(glStencilFunc, (unsigned int func, int ref, unsigned int mask), (func, ref, mask)) \
+    PROC(glStencilMask, (unsigned int mask), (mask)) \
+    PROC(glStencilOp, (unsigned int fail, unsigned int zfail, unsigned int zpass), (fail, zfail, zpass)) \
+    PROC(glTexImage2D, (unsigned int target, int level, int internalformat, int width, int height, int border, unsigned int format, unsigned int type, const void *pixels), (target, level, internalformat, width, height, border, format, type, pixels)) \
+    PROC(glTexParameteri, (unsigned int target, unsigned int pname, int param), (target, pname, param)) \
+    PROC(glTexSubImage2D, (unsigned int target, int level, int xoffset, int yoffset, int width, int height, unsigned int format, unsigned int type, const void *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels)) \
+    PROC(glUniform1f, (int location, float v0), (location, v0)) \
+    PROC(glUniform1i, (int location, int v0), (location, v0)) \
+    PROC(glUniform4f, (int location, float v0, float v1, float v2, float v3), (location, v0, v1, v2, v3)) \
+    PROC(glUniformMatrix4fv, (int location, int count, unsigned char transpose, const float *value), (location, count, transpose, value)) \
+    PROC(glUseProgram, (unsigned int program), (program)) \
+    PROC(glVertexAttribPointer, (unsigned int index, int size, unsigned int type, unsigned char normalized, int stride, const void *pointer), (index, size, type, normalized, stride, pointer)) \
+    PROC(glViewport, (int x, int y, int width, int height), (x, y, width, height))
+
+#define WAFFLE_GL_DISPATCH_FUNC__(ret, name, params, args) ret (*name) params;
+#define WAFFLE_GL_DISPATCH_PROC__(name, params, args) void (*name) params;
+
+struct waffle_gl_dispatch {
+    WAFFLE_GL_DISPATCH_FUNCTIONS(WAFFLE_GL_DISPATCH_FUNC__,
+                                 WAFFLE_GL_DISPATCH_PROC__)
+};
+
+#undef WAFFLE_GL_DISPATCH_FUNC__
+#undef WAFFLE_GL_DISPATCH_PROC__
+
+/// @brief Get the context's dispatch table, creating it on the first call.
+///
+/// The table lives until the context is destroyed.
+WAFFLE_API const struct waffle_gl_dispatch*
+waffle_context_get_gl_dispatch(struct waffle_context *ctx);
+
+#endif // WAFFLE_API_EXPERIMENTAL && WAFFLE_API_VERSION >= 0x0103
+
+#ifdef __cplusplus
+} // end extern "C"
+#endif
@@ -30,12 +30,16 @@ file(MAKE_DIRECTORY ${html_out_dir})
 set(html_outputs
     ${html_out_dir}/wflinfo.1.html
     ${html_out_dir}/waffle_attrib_list.3.html
+    ${html_out_dir}/waffle_capture.3.html
     ${html_out_dir}/waffle_config.3.html
     ${html_out_dir}/waffle_context.3.html
+    ${html_out_dir}/waffle_device.3.html
+    ${html_out_dir}/waffle_device_egl.3.html
     ${html_out_dir}/waffle_display.3.html
     ${html_out_dir}/waffle_dl.3.html
     ${html_out_dir}/waffle_enum.3.html
     ${html_out_dir}/waffle_error.3.html
+    ${html_out_dir}/waffle_fence.3.html
     ${html_out_dir}/waffle_gbm.3.html
     ${html_out_dir}/waffle_get_proc_address.3.html
     ${html_out_dir}/waffle_glx.3.html
@@ -43,6 +47,8 @@ set(html_outputs
     ${html_out_dir}/waffle_is_extension_in_string.3.html
     ${html_out_dir}/waffle_make_current.3.html
     ${html_out_dir}/waffle_native.3.html
+    ${html_out_dir}/waffle_readback.3.html
+    ${html_out_dir}/waffle_surfaceless_egl.3.html
     ${html_out_dir}/waffle_wayland.3.html
     ${html_out_dir}/waffle_window.3.html
     ${html_out_dir}/waffle_x11_egl.3.html
@@ -68,12 +74,16 @@ endfunction()
 
 waffle_add_html(1 wflinfo)
 waffle_add_html(3 waffle_attrib_list)
+waffle_add_html(3 waffle_capture)
 waffle_add_html(3 waffle_config)
 waffle_add_html(3 waffle_context)
+waffle_add_html(3 waffle_device)
+waffle_add_html(3 waffle_device_egl)
 waffle_add_html(3 waffle_display)
 waffle_add_html(3 waffle_dl)
 waffle_add_html(3 waffle_enum)
 waffle_add_html(3 waffle_error)
+waffle_add_html(3 waffle_fence)
 waffle_add_html(3 waffle_gbm)
 waffle_add_html(3 waffle_get_proc_address)
 waffle_add_html(3 waffle_glx)
@@ -81,6 +91,8 @@ waffle_add_html(3 waffle_init)
 waffle_add_html(3 waffle_is_extension_in_string)
 waffle_add_html(3 waffle_make_current)
 waffle_add_html(3 waffle_native)
+waffle_add_html(3 waffle_readback)
+waffle_add_html(3 waffle_surfaceless_egl)
 waffle_add_html(3 waffle_wayland)
 waffle_add_html(3 waffle_window)
 waffle_add_html(3 waffle_x11_egl)
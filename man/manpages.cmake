@@ -32,12 +32,16 @@ file(MAKE_DIRECTORY ${man_out_dir}/man7)
 set(man_outputs
     ${man_out_dir}/man1/wflinfo.1
     ${man_out_dir}/man3/waffle_attrib_list.3
+    ${man_out_dir}/man3/waffle_capture.3
     ${man_out_dir}/man3/waffle_config.3
     ${man_out_dir}/man3/waffle_context.3
+    ${man_out_dir}/man3/waffle_device.3
+    ${man_out_dir}/man3/waffle_device_egl.3
     ${man_out_dir}/man3/waffle_display.3
     ${man_out_dir}/man3/waffle_dl.3
     ${man_out_dir}/man3/waffle_enum.3
     ${man_out_dir}/man3/waffle_error.3
+    ${man_out_dir}/man3/waffle_fence.3
     ${man_out_dir}/man3/waffle_gbm.3
     ${man_out_dir}/man3/waffle_get_proc_address.3
     ${man_out_dir}/man3/waffle_glx.3
@@ -45,6 +49,8 @@ set(man_outputs
     ${man_out_dir}/man3/waffle_is_extension_in_string.3
     ${man_out_dir}/man3/waffle_make_current.3
     ${man_out_dir}/man3/waffle_native.3
+    ${man_out_dir}/man3/waffle_readback.3
+    ${man_out_dir}/man3/waffle_surfaceless_egl.3
     ${man_out_dir}/man3/waffle_wayland.3
     ${man_out_dir}/man3/waffle_window.3
     ${man_out_dir}/man3/waffle_x11_egl.3
@@ -68,12 +74,16 @@ endfunction()
 
 waffle_add_manpage(1 wflinfo)
 waffle_add_manpage(3 waffle_attrib_list)
+waffle_add_manpage(3 waffle_capture)
 waffle_add_manpage(3 waffle_config)
 waffle_add_manpage(3 waffle_context)
+waffle_add_manpage(3 waffle_device)
+waffle_add_manpage(3 waffle_device_egl)
 waffle_add_manpage(3 waffle_display)
 waffle_add_manpage(3 waffle_dl)
 waffle_add_manpage(3 waffle_enum)
 waffle_add_manpage(3 waffle_error)
+waffle_add_manpage(3 waffle_fence)
 waffle_add_manpage(3 waffle_gbm)
 waffle_add_manpage(3 waffle_get_proc_address)
 waffle_add_manpage(3 waffle_glx)
@@ -81,6 +91,8 @@ waffle_add_manpage(3 waffle_init)
 waffle_add_manpage(3 waffle_is_extension_in_string)
 waffle_add_manpage(3 waffle_make_current)
 waffle_add_manpage(3 waffle_native)
+waffle_add_manpage(3 waffle_readback)
+waffle_add_manpage(3 waffle_surfaceless_egl)
 waffle_add_manpage(3 waffle_wayland)
 waffle_add_manpage(3 waffle_window)
 waffle_add_manpage(3 waffle_x11_egl)
@@ -32,7 +32,9 @@
 
 #include "wegl_config.h"
 #include "wegl_context.h"
+#include "wegl_fence.h"
 #include "wegl_util.h"
+#include "wegl_window.h"
 
 #include "droid_display.h"
 #include "droid_platform.h"
@@ -102,13 +104,42 @@ droid_dl_sym(
                                  waffle_dl, name);
 }
 
+static void
+droid_dl_sym_array(struct wcore_platform *wc_self,
+                   int32_t waffle_dl,
+                   int32_t count,
+                   const char *const names[],
+                   void *syms[])
+{
+    linux_platform_dl_sym_array(droid_platform(wc_self)->linux,
+                                waffle_dl, count, names, syms);
+}
+
+static void
+droid_get_symbol_cache_stats(struct wcore_platform *wc_self,
+                             struct waffle_symbol_cache_stats *stats)
+{
+    linux_platform_get_symbol_cache_stats(droid_platform(wc_self)->linux, stats);
+}
+
+static void*
+droid_get_proc_address(struct wcore_platform *wc_self,
+                       const char *name)
+{
+    return linux_platform_get_proc_address(droid_platform(wc_self)->linux,
+                                           wc_self, wegl_get_proc_address,
+                                           name);
+}
+
 static const struct wcore_platform_vtbl droid_platform_vtbl = {
     .destroy = droid_platform_destroy,
 
     .make_current = wegl_make_current,
-    .get_proc_address = wegl_get_proc_address,
+    .get_proc_address = droid_get_proc_address,
     .dl_can_open = droid_dl_can_open,
     .dl_sym = droid_dl_sym,
+    .dl_sym_array = droid_dl_sym_array,
+    .get_symbol_cache_stats = droid_get_symbol_cache_stats,
 
     .display = {
         .connect = droid_display_connect,
@@ -121,12 +152,14 @@ static const struct wcore_platform_vtbl droid_platform_vtbl = {
         .choose = wegl_config_choose,
         .destroy = wegl_config_destroy,
         .get_native = NULL,
+        .get_attrib = wegl_config_get_attrib,
     },
 
     .context = {
         .create = wegl_context_create,
         .destroy = wegl_context_destroy,
         .get_native = NULL,
+        .get_priority = wegl_context_get_priority,
     },
 
     .window = {
@@ -134,7 +167,19 @@ static const struct wcore_platform_vtbl droid_platform_vtbl = {
         .destroy = droid_window_destroy,
         .show = droid_window_show,
         .swap_buffers = wegl_window_swap_buffers,
+        .swap_buffers_with_damage = wegl_window_swap_buffers_with_damage,
         .resize = droid_window_resize,
+        .get_buffer_age = wegl_window_get_buffer_age,
+        .set_damage_region = wegl_window_set_damage_region,
+        .set_swap_interval = wegl_window_set_swap_interval,
+        .set_render_buffer = wegl_window_set_render_buffer,
         .get_native = NULL,
     },
+
+    .fence = {
+        .create = wegl_fence_create,
+        .destroy = wegl_fence_destroy,
+        .wait = wegl_fence_wait,
+        .export_fd = wegl_fence_export_fd,
+    },
 };
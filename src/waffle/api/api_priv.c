@@ -34,8 +34,10 @@
 #include "api_object.h"
 #include "api_priv.h"
 
+#include "wcore_context.h"
 #include "wcore_error.h"
 #include "wcore_platform.h"
+#include "wcore_tinfo.h"
 
 struct wcore_platform *api_platform = 0;
 
@@ -64,4 +66,105 @@ api_check_entry(const struct api_object *obj_list[], int length)
     return true;
 }
 
+void
+api_forget_current(const void *obj)
+{
+    struct wcore_tinfo *tinfo = wcore_tinfo_get();
+
+    if (obj == NULL)
+        return;
+
+    if (obj == tinfo->current.display ||
+        obj == tinfo->current.window ||
+        obj == tinfo->current.context) {
+        tinfo->current.display = NULL;
+        tinfo->current.window = NULL;
+        tinfo->current.context = NULL;
+    }
+}
+
+bool
+api_check_symbol_array(int32_t count,
+                       const char *const names[],
+                       void *syms[])
+{
+    if (count < 0) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "symbol count is negative");
+        return false;
+    }
+
+    if (count > 0 && (names == NULL || syms == NULL)) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "null pointer");
+        return false;
+    }
+
+    for (int32_t i = 0; i < count; ++i) {
+        if (names[i] == NULL) {
+            wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                         "symbol name %d is null", i);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static int32_t
+dl_from_context_api(int32_t context_api)
+{
+    switch (context_api) {
+        case WAFFLE_CONTEXT_OPENGL:     return WAFFLE_DL_OPENGL;
+        case WAFFLE_CONTEXT_OPENGL_ES1: return WAFFLE_DL_OPENGL_ES1;
+        case WAFFLE_CONTEXT_OPENGL_ES2: return WAFFLE_DL_OPENGL_ES2;
+        case WAFFLE_CONTEXT_OPENGL_ES3: return WAFFLE_DL_OPENGL_ES3;
+        default:                        return 0;
+    }
+}
+
+void*
+api_resolve_gl_proc(struct wcore_context *ctx, const char *name)
+{
+    int32_t dl = dl_from_context_api(ctx->context_api);
+    void *proc = NULL;
+
+    // A failed lookup is not the user's error, so do not clobber the error
+    // state of the calling thread.
+    WCORE_ERROR_DISABLED({
+        if (dl && api_platform->vtbl->dl_can_open(api_platform, dl))
+            proc = api_platform->vtbl->dl_sym(api_platform, dl, name);
+
+        if (!proc)
+            proc = api_platform->vtbl->get_proc_address(api_platform, name);
+    });
+
+    return proc;
+}
+
+bool
+api_check_symbol_array_result(int32_t count,
+                              const char *const names[],
+                              void *syms[])
+{
+    int32_t num_failed = 0;
+    int32_t first_failed = -1;
+
+    for (int32_t i = 0; i < count; ++i) {
+        if (syms[i] == NULL) {
+            if (num_failed++ == 0)
+                first_failed = i;
+        }
+    }
+
+    if (num_failed == 0)
+        return true;
+
+    // If the platform already emitted an error for the first failed
+    // symbol, that error is kept.
+    wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                 "failed to resolve %d of %d symbols, the first being "
+                 "\"%s\"", num_failed, count, names[first_failed]);
+    return false;
+}
+
 /// @}
@@ -35,11 +35,14 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include "waffle.h"
 
 struct api_object;
+struct wcore_context;
 struct wcore_platform;
+struct wcore_window;
 
 /// @brief Managed by waffle_init().
 ///
@@ -59,4 +62,83 @@ extern struct wcore_platform *api_platform;
 bool
 api_check_entry(const struct api_object *obj_list[], int length);
 
+/// @brief Forget this thread's current objects if any of them is @a obj.
+///
+/// Call this before destroying a display, window, or context, so that a new
+/// object allocated at the same address is not mistaken for a current one.
+void
+api_forget_current(const void *obj);
+
+/// @brief Validate the arguments of a `waffle_*_array` symbol lookup.
+///
+/// Emit WAFFLE_ERROR_BAD_PARAMETER and return false if @a count is
+/// negative, or if @a names, @a syms, or any name is null.
+bool
+api_check_symbol_array(int32_t count,
+                       const char *const names[],
+                       void *syms[]);
+
+/// @brief Resolve the OpenGL function @a name for the API of @a ctx.
+///
+/// Prefer the symbol exported by the API's library, because before EGL 1.5
+/// eglGetProcAddress is not required to return core functions, and may
+/// return a non-null pointer for functions that do not exist. Fall back to
+/// get_proc_address for functions that the library does not export.
+///
+/// The lookup never emits an error.
+void*
+api_resolve_gl_proc(struct wcore_context *ctx, const char *name);
+
+/// @brief Emit an error if any of the @a count entries of @a syms is null.
+///
+/// @return true if all symbols were resolved.
+bool
+api_check_symbol_array_result(int32_t count,
+                              const char *const names[],
+                              void *syms[]);
+
+/// @name Readback internals
+///
+/// The bodies of the `waffle_readback_*` entry points, for use inside
+/// waffle. They do not reset the error state.
+/// @{
+
+struct waffle_readback*
+api_readback_create(struct wcore_context *ctx,
+                    int32_t width,
+                    int32_t height,
+                    int32_t format,
+                    int32_t depth);
+
+void
+api_readback_destroy(struct waffle_readback *self);
+
+bool
+api_readback_begin(struct waffle_readback *self,
+                   struct wcore_window *window);
+
+int32_t
+api_readback_get_num_pending(struct waffle_readback *self);
+
+const void*
+api_readback_map_oldest(struct waffle_readback *self);
+
+bool
+api_readback_unmap(struct waffle_readback *self);
+
+/// @}
+
+/// @brief Queue the back buffer of the capture's window for its sink.
+///
+/// Call this before the window's buffers are swapped. It requires a
+/// current context. If the frame cannot be queued, it is counted as
+/// dropped and its error is kept for waffle_capture_get_stats(); the
+/// thread's error state is left untouched so the swap can still proceed.
+void
+api_capture_frame(struct waffle_capture *capture);
+
+/// @brief Detach @a capture from its window without checking the entry.
+bool
+api_capture_detach(struct waffle_capture *capture);
+
 /// @}
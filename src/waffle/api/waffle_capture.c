@@ -0,0 +1,295 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @addtogroup waffle_capture
+/// @{
+
+/// @file
+
+#include <stdlib.h>
+
+#include "api_priv.h"
+
+#include "wcore_attrib_list.h"
+#include "wcore_capture.h"
+#include "wcore_error.h"
+#include "wcore_tinfo.h"
+#include "wcore_window.h"
+
+// Waffle does not include the GL headers.
+#define GL_RGBA                         0x1908
+
+/// Frame N is read while frame N+1 renders, and is pushed to the sink
+/// before the read of frame N+2 is queued.
+#define CAPTURE_READBACK_DEPTH 2
+
+struct waffle_capture {
+    struct wcore_window *window;
+    struct wcore_capture *sink;
+
+    int32_t width;
+    int32_t height;
+
+    /// @brief Created at the first frame, for the context current then.
+    ///
+    /// Null if the context does not support readback. Its frames are then
+    /// dropped without retrying the creation.
+    struct waffle_readback *readback;
+    struct wcore_context *readback_ctx;
+
+    /// @brief Why the last dropped frame could not be captured.
+    enum waffle_error last_error;
+};
+
+static bool
+capture_check_keys(const int32_t attrib_list[])
+{
+    for (int32_t i = 0; attrib_list[i]; i += 2) {
+        switch (attrib_list[i]) {
+            case WAFFLE_CAPTURE_FD:
+            case WAFFLE_CAPTURE_SINK:
+            case WAFFLE_CAPTURE_FORMAT:
+            case WAFFLE_CAPTURE_POLICY:
+            case WAFFLE_CAPTURE_QUEUE_DEPTH:
+            case WAFFLE_CAPTURE_RING_SLOTS:
+            case WAFFLE_CAPTURE_FRAME_RATE:
+                break;
+            default:
+                wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                             "unrecognized attribute 0x%x at attrib_list[%d]",
+                             attrib_list[i], i);
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/// @brief Push the oldest pending frame to the sink.
+static bool
+capture_push_oldest(struct waffle_capture *self)
+{
+    const void *pixels;
+
+    pixels = api_readback_map_oldest(self->readback);
+    if (!pixels)
+        return false;
+
+    wcore_capture_push(self->sink, pixels);
+    return api_readback_unmap(self->readback);
+}
+
+/// @brief Release the readback, pushing its frames if its context is current.
+static bool
+capture_release_readback(struct waffle_capture *self)
+{
+    bool ok = true;
+
+    if (!self->readback)
+        return true;
+
+    if (wcore_tinfo_get()->current.context == self->readback_ctx) {
+        while (ok && api_readback_get_num_pending(self->readback) > 0)
+            ok = capture_push_oldest(self);
+    }
+
+    // Frames still pending were captured but will never be written.
+    wcore_capture_count_dropped(self->sink,
+                                api_readback_get_num_pending(self->readback));
+
+    api_readback_destroy(self->readback);
+    self->readback = NULL;
+    self->readback_ctx = NULL;
+    return ok;
+}
+
+/// @return WAFFLE_NO_ERROR if the frame was queued. A failure of the readback
+/// itself is reported as WAFFLE_ERROR_UNKNOWN.
+static enum waffle_error
+capture_queue_frame(struct waffle_capture *self)
+{
+    struct wcore_context *ctx = wcore_tinfo_get()->current.context;
+
+    if (!ctx || wcore_tinfo_get()->current.window != self->window)
+        return WAFFLE_ERROR_BAD_PARAMETER;
+
+    if (self->readback_ctx != ctx) {
+        if (!capture_release_readback(self))
+            return WAFFLE_ERROR_UNKNOWN;
+
+        self->readback_ctx = ctx;
+        self->readback = api_readback_create(ctx,
+                                             self->width, self->height,
+                                             GL_RGBA,
+                                             CAPTURE_READBACK_DEPTH);
+    }
+
+    if (!self->readback)
+        return WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM;
+
+    if (api_readback_get_num_pending(self->readback)
+            == CAPTURE_READBACK_DEPTH) {
+        if (!capture_push_oldest(self))
+            return WAFFLE_ERROR_UNKNOWN;
+    }
+
+    if (!api_readback_begin(self->readback, self->window))
+        return WAFFLE_ERROR_UNKNOWN;
+
+    return WAFFLE_NO_ERROR;
+}
+
+void
+api_capture_frame(struct waffle_capture *self)
+{
+    enum waffle_error error;
+
+    // The swap's own error state must not see the capture's.
+    WCORE_ERROR_DISABLED({
+        error = capture_queue_frame(self);
+    });
+
+    if (error != WAFFLE_NO_ERROR) {
+        self->last_error = error;
+        wcore_capture_count_dropped(self->sink, 1);
+    }
+}
+
+bool
+api_capture_detach(struct waffle_capture *self)
+{
+    bool ok;
+
+    ok = capture_release_readback(self);
+    ok &= wcore_capture_destroy(self->sink);
+
+    self->window->capture = NULL;
+    free(self);
+    return ok;
+}
+
+struct waffle_capture*
+waffle_window_attach_capture(
+        struct waffle_window *window,
+        const int32_t attrib_list[])
+{
+    struct wcore_window *wc_window = wcore_window(window);
+    struct wcore_capture_options opts;
+    struct waffle_capture *self;
+
+    const struct api_object *obj_list[] = {
+        wc_window ? &wc_window->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return NULL;
+
+    if (wc_window->capture) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "the window already has a capture");
+        return NULL;
+    }
+
+    if (attrib_list && !capture_check_keys(attrib_list))
+        return NULL;
+
+    if (!attrib_list ||
+        !wcore_attrib_list_get(attrib_list, WAFFLE_CAPTURE_FD, &opts.fd)) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "attrib_list must contain WAFFLE_CAPTURE_FD");
+        return NULL;
+    }
+
+    wcore_attrib_list_get_with_default(attrib_list, WAFFLE_CAPTURE_SINK,
+                                       &opts.sink,
+                                       WAFFLE_CAPTURE_SINK_STREAM);
+    wcore_attrib_list_get_with_default(attrib_list, WAFFLE_CAPTURE_FORMAT,
+                                       &opts.format,
+                                       WAFFLE_CAPTURE_FORMAT_RAW);
+    wcore_attrib_list_get_with_default(attrib_list, WAFFLE_CAPTURE_POLICY,
+                                       &opts.policy,
+                                       WAFFLE_CAPTURE_POLICY_BLOCK);
+    wcore_attrib_list_get_with_default(attrib_list, WAFFLE_CAPTURE_QUEUE_DEPTH,
+                                       &opts.queue_depth, 4);
+    wcore_attrib_list_get_with_default(attrib_list, WAFFLE_CAPTURE_RING_SLOTS,
+                                       &opts.ring_slots, 4);
+    wcore_attrib_list_get_with_default(attrib_list, WAFFLE_CAPTURE_FRAME_RATE,
+                                       &opts.frame_rate, 30);
+    opts.width = wc_window->width;
+    opts.height = wc_window->height;
+
+    self = wcore_calloc(sizeof(*self));
+    if (!self)
+        return NULL;
+
+    self->sink = wcore_capture_create(&opts);
+    if (!self->sink) {
+        free(self);
+        return NULL;
+    }
+
+    self->window = wc_window;
+    self->width = opts.width;
+    self->height = opts.height;
+    wc_window->capture = self;
+    return self;
+}
+
+bool
+waffle_capture_detach(struct waffle_capture *self)
+{
+    const struct api_object *obj_list[] = {
+        self ? &self->window->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    return api_capture_detach(self);
+}
+
+bool
+waffle_capture_get_stats(
+        struct waffle_capture *self,
+        struct waffle_capture_stats *stats)
+{
+    const struct api_object *obj_list[] = {
+        self ? &self->window->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (stats == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "stats is null");
+        return false;
+    }
+
+    wcore_capture_get_stats(self->sink, stats);
+    stats->last_error = self->last_error;
+    return true;
+}
+
+/// @}
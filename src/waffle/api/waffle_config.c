@@ -100,4 +100,56 @@ waffle_config_get_native(struct waffle_config *self)
     }
 }
 
+bool
+waffle_config_get_attrib(
+        struct waffle_config *self,
+        int32_t attrib,
+        int32_t *value)
+{
+    struct wcore_config *wc_self = wcore_config(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (value == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "value is null");
+        return false;
+    }
+
+    switch (attrib) {
+        case WAFFLE_RED_SIZE:
+        case WAFFLE_GREEN_SIZE:
+        case WAFFLE_BLUE_SIZE:
+        case WAFFLE_ALPHA_SIZE:
+        case WAFFLE_DEPTH_SIZE:
+        case WAFFLE_STENCIL_SIZE:
+        case WAFFLE_SAMPLE_BUFFERS:
+        case WAFFLE_SAMPLES:
+            break;
+        default:
+            wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                         "attribute 0x%x cannot be queried", attrib);
+            return false;
+    }
+
+    if (wc_self->attrs.context_no_config) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "a config chosen with WAFFLE_CONTEXT_NO_CONFIG has no "
+                     "buffers");
+        return false;
+    }
+
+    if (api_platform->vtbl->config.get_attrib) {
+        return api_platform->vtbl->config.get_attrib(wc_self, attrib, value);
+    }
+    else {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
+}
+
 /// @}
@@ -74,6 +74,7 @@ waffle_context_destroy(struct waffle_context *self)
     if (!api_check_entry(obj_list, 1))
         return false;
 
+    api_forget_current(wc_self);
     return api_platform->vtbl->context.destroy(wc_self);
 }
 
@@ -98,4 +99,32 @@ waffle_context_get_native(struct waffle_context *self)
     }
 }
 
+bool
+waffle_context_get_priority(
+        struct waffle_context *self,
+        int32_t *priority)
+{
+    struct wcore_context *wc_self = wcore_context(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (priority == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "priority is null");
+        return false;
+    }
+
+    if (api_platform->vtbl->context.get_priority) {
+        return api_platform->vtbl->context.get_priority(wc_self, priority);
+    }
+    else {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
+}
+
 /// @}
@@ -62,6 +62,7 @@ waffle_display_disconnect(struct waffle_display *self)
     if (!api_check_entry(obj_list, 1))
         return false;
 
+    api_forget_current(wc_self);
     return api_platform->vtbl->display.destroy(wc_self);
 }
 
@@ -72,4 +72,51 @@ waffle_dl_sym(int32_t dl, const char *name)
     return api_platform->vtbl->dl_sym(api_platform, dl, name);
 }
 
+bool
+waffle_dl_sym_array(int32_t dl,
+                    int32_t count,
+                    const char *const names[],
+                    void *syms[])
+{
+    if (!api_check_entry(NULL, 0))
+        return false;
+
+    if (!waffle_dl_check_enum(dl))
+        return false;
+
+    if (!api_check_symbol_array(count, names, syms))
+        return false;
+
+    if (api_platform->vtbl->dl_sym_array) {
+        api_platform->vtbl->dl_sym_array(api_platform, dl, count, names, syms);
+    }
+    else {
+        for (int32_t i = 0; i < count; ++i)
+            syms[i] = api_platform->vtbl->dl_sym(api_platform, dl, names[i]);
+    }
+
+    return api_check_symbol_array_result(count, names, syms);
+}
+
+bool
+waffle_get_symbol_cache_stats(struct waffle_symbol_cache_stats *stats)
+{
+    if (!api_check_entry(NULL, 0))
+        return false;
+
+    if (stats == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "stats is null");
+        return false;
+    }
+
+    if (!api_platform->vtbl->get_symbol_cache_stats) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "the platform does not cache symbols");
+        return false;
+    }
+
+    api_platform->vtbl->get_symbol_cache_stats(api_platform, stats);
+    return true;
+}
+
 /// @}
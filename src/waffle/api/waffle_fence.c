@@ -0,0 +1,130 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @addtogroup waffle_fence
+/// @{
+
+/// @file
+
+#include "api_priv.h"
+
+#include "wcore_context.h"
+#include "wcore_error.h"
+#include "wcore_fence.h"
+#include "wcore_platform.h"
+#include "wcore_tinfo.h"
+
+struct waffle_fence*
+waffle_fence_create(struct waffle_context *ctx)
+{
+    struct wcore_context *wc_ctx = wcore_context(ctx);
+    struct wcore_fence *wc_self;
+
+    const struct api_object *obj_list[] = {
+        wc_ctx ? &wc_ctx->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return NULL;
+
+    if (!api_platform->vtbl->fence.create) {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return NULL;
+    }
+
+    if (wcore_tinfo_get()->current.context != wc_ctx) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "the fence's context must be current");
+        return NULL;
+    }
+
+    wc_self = api_platform->vtbl->fence.create(api_platform, wc_ctx);
+    if (!wc_self)
+        return NULL;
+
+    return &wc_self->wfl;
+}
+
+bool
+waffle_fence_destroy(struct waffle_fence *self)
+{
+    struct wcore_fence *wc_self = wcore_fence(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    return api_platform->vtbl->fence.destroy(wc_self);
+}
+
+bool
+waffle_fence_wait(struct waffle_fence *self, uint64_t timeout_ns)
+{
+    struct wcore_fence *wc_self = wcore_fence(self);
+    bool signaled = false;
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (!api_platform->vtbl->fence.wait(wc_self, timeout_ns, &signaled))
+        return false;
+
+    return signaled;
+}
+
+bool
+waffle_fence_is_signaled(struct waffle_fence *self)
+{
+    return waffle_fence_wait(self, 0);
+}
+
+int
+waffle_fence_export_fd(struct waffle_fence *self)
+{
+    struct wcore_fence *wc_self = wcore_fence(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return -1;
+
+    if (!api_platform->vtbl->fence.export_fd) {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return -1;
+    }
+
+    return api_platform->vtbl->fence.export_fd(wc_self);
+}
+
+/// @}
@@ -0,0 +1,148 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @addtogroup waffle_gl_dispatch
+/// @{
+
+/// @file
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "waffle_gl_dispatch.h"
+
+#include "api_priv.h"
+
+#include "wcore_context.h"
+#include "wcore_error.h"
+#include "wcore_platform.h"
+#include "wcore_tinfo.h"
+
+static struct waffle_gl_dispatch*
+bind_current(const char *name, size_t offset);
+
+// Each trampoline binds its entry in the current context's table, then
+// forwards the call through the now-resolved entry.
+
+#define TRAMPOLINE_FUNC(ret, name, params, args) \
+    static ret \
+    trampoline_##name params \
+    { \
+        return bind_current(#name, \
+                            offsetof(struct waffle_gl_dispatch, name)) \
+               ->name args; \
+    }
+
+#define TRAMPOLINE_PROC(name, params, args) \
+    static void \
+    trampoline_##name params \
+    { \
+        bind_current(#name, offsetof(struct waffle_gl_dispatch, name)) \
+            ->name args; \
+    }
+
+WAFFLE_GL_DISPATCH_FUNCTIONS(TRAMPOLINE_FUNC, TRAMPOLINE_PROC)
+
+#undef TRAMPOLINE_FUNC
+#undef TRAMPOLINE_PROC
+
+#define TRAMPOLINE_ENTRY_FUNC(ret, name, params, args) .name = trampoline_##name,
+#define TRAMPOLINE_ENTRY_PROC(name, params, args) .name = trampoline_##name,
+
+/// @brief The initial value of every table.
+static const struct waffle_gl_dispatch trampolines = {
+    WAFFLE_GL_DISPATCH_FUNCTIONS(TRAMPOLINE_ENTRY_FUNC, TRAMPOLINE_ENTRY_PROC)
+};
+
+#undef TRAMPOLINE_ENTRY_FUNC
+#undef TRAMPOLINE_ENTRY_PROC
+
+/// @brief Guards the lazy creation of tables.
+static pthread_mutex_t create_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void __attribute__((noreturn))
+dispatch_abort(const char *name, const char *reason)
+{
+    fprintf(stderr, "waffle: fatal-error: %s called through "
+            "waffle_gl_dispatch: %s\n", name, reason);
+    abort();
+}
+
+static struct waffle_gl_dispatch*
+get_or_create_table(struct wcore_context *ctx)
+{
+    pthread_mutex_lock(&create_mutex);
+
+    if (!ctx->gl_dispatch) {
+        ctx->gl_dispatch = wcore_malloc(sizeof(*ctx->gl_dispatch));
+        if (ctx->gl_dispatch)
+            memcpy(ctx->gl_dispatch, &trampolines, sizeof(trampolines));
+    }
+
+    pthread_mutex_unlock(&create_mutex);
+
+    return ctx->gl_dispatch;
+}
+
+static struct waffle_gl_dispatch*
+bind_current(const char *name, size_t offset)
+{
+    struct wcore_context *ctx = wcore_tinfo_get()->current.context;
+    struct waffle_gl_dispatch *table;
+    void *proc;
+
+    if (!ctx)
+        dispatch_abort(name, "no context is current");
+
+    table = get_or_create_table(ctx);
+    if (!table)
+        dispatch_abort(name, "out of memory");
+
+    proc = api_resolve_gl_proc(ctx, name);
+    if (!proc)
+        dispatch_abort(name, "failed to resolve the function");
+
+    memcpy((char*) table + offset, &proc, sizeof(proc));
+    return table;
+}
+
+const struct waffle_gl_dispatch*
+waffle_context_get_gl_dispatch(struct waffle_context *ctx)
+{
+    struct wcore_context *wc_ctx = wcore_context(ctx);
+
+    const struct api_object *obj_list[] = {
+        wc_ctx ? &wc_ctx->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return NULL;
+
+    return get_or_create_table(wc_ctx);
+}
+
+/// @}
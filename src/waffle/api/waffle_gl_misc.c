@@ -37,6 +37,7 @@
 #include "wcore_display.h"
 #include "wcore_error.h"
 #include "wcore_platform.h"
+#include "wcore_tinfo.h"
 #include "wcore_window.h"
 
 bool
@@ -85,6 +86,8 @@ waffle_make_current(
     struct wcore_display *wc_dpy = wcore_display(dpy);
     struct wcore_window *wc_window = wcore_window(window);
     struct wcore_context *wc_ctx = wcore_context(ctx);
+    struct wcore_tinfo *tinfo;
+    bool ok;
 
     const struct api_object *obj_list[3];
     int len = 0;
@@ -98,10 +101,64 @@ waffle_make_current(
     if (!api_check_entry(obj_list, len))
         return false;
 
-    return api_platform->vtbl->make_current(api_platform,
-                                            wc_dpy,
-                                            wc_window,
-                                            wc_ctx);
+    // Rebinding the current objects is a no-op, yet the driver may still
+    // flush and take locks. Release is always forwarded, because the
+    // application may have bound a context behind Waffle's back.
+    tinfo = wcore_tinfo_get();
+    if (wc_ctx &&
+        wc_ctx == tinfo->current.context &&
+        wc_window == tinfo->current.window &&
+        wc_dpy == tinfo->current.display) {
+        return true;
+    }
+
+    ok = api_platform->vtbl->make_current(api_platform,
+                                          wc_dpy,
+                                          wc_window,
+                                          wc_ctx);
+    if (!ok)
+        return false;
+
+    tinfo->current.display = wc_ctx ? wc_dpy : NULL;
+    tinfo->current.window = wc_ctx ? wc_window : NULL;
+    tinfo->current.context = wc_ctx;
+    return true;
+}
+
+struct waffle_display*
+waffle_get_current_display(void)
+{
+    struct wcore_display *wc_dpy;
+
+    if (!api_check_entry(NULL, 0))
+        return NULL;
+
+    wc_dpy = wcore_tinfo_get()->current.display;
+    return wc_dpy ? &wc_dpy->wfl : NULL;
+}
+
+struct waffle_window*
+waffle_get_current_window(void)
+{
+    struct wcore_window *wc_window;
+
+    if (!api_check_entry(NULL, 0))
+        return NULL;
+
+    wc_window = wcore_tinfo_get()->current.window;
+    return wc_window ? &wc_window->wfl : NULL;
+}
+
+struct waffle_context*
+waffle_get_current_context(void)
+{
+    struct wcore_context *wc_ctx;
+
+    if (!api_check_entry(NULL, 0))
+        return NULL;
+
+    wc_ctx = wcore_tinfo_get()->current.context;
+    return wc_ctx ? &wc_ctx->wfl : NULL;
 }
 
 void*
@@ -113,4 +170,23 @@ waffle_get_proc_address(const char *name)
     return api_platform->vtbl->get_proc_address(api_platform, name);
 }
 
+bool
+waffle_get_proc_address_array(int32_t count,
+                              const char *const names[],
+                              void *procs[])
+{
+    if (!api_check_entry(NULL, 0))
+        return false;
+
+    if (!api_check_symbol_array(count, names, procs))
+        return false;
+
+    for (int32_t i = 0; i < count; ++i) {
+        procs[i] = api_platform->vtbl->get_proc_address(api_platform,
+                                                        names[i]);
+    }
+
+    return api_check_symbol_array_result(count, names, procs);
+}
+
 /// @}
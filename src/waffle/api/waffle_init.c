@@ -39,6 +39,8 @@ struct wcore_platform* glx_platform_create(void);
 struct wcore_platform* wayland_platform_create(void);
 struct wcore_platform* xegl_platform_create(void);
 struct wcore_platform* wgbm_platform_create(void);
+struct wcore_platform* sl_platform_create(void);
+struct wcore_platform* degl_platform_create(void);
 
 static bool
 waffle_init_parse_attrib_list(
@@ -102,6 +104,18 @@ waffle_init_parse_attrib_list(
                     CASE_UNDEFINED_PLATFORM(GBM)
 #endif
 
+#ifdef WAFFLE_HAS_SURFACELESS_EGL
+                    CASE_DEFINED_PLATFORM(SURFACELESS_EGL)
+#else
+                    CASE_UNDEFINED_PLATFORM(SURFACELESS_EGL)
+#endif
+
+#ifdef WAFFLE_HAS_DEVICE_EGL
+                    CASE_DEFINED_PLATFORM(DEVICE_EGL)
+#else
+                    CASE_UNDEFINED_PLATFORM(DEVICE_EGL)
+#endif
+
                     default:
                         wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
                                      "WAFFLE_PLATFORM has bad value 0x%x",
@@ -157,6 +171,14 @@ waffle_init_create_platform(int32_t waffle_platform)
 #ifdef WAFFLE_HAS_GBM
         case WAFFLE_PLATFORM_GBM:
             return wgbm_platform_create();
+#endif
+#ifdef WAFFLE_HAS_SURFACELESS_EGL
+        case WAFFLE_PLATFORM_SURFACELESS_EGL:
+            return sl_platform_create();
+#endif
+#ifdef WAFFLE_HAS_DEVICE_EGL
+        case WAFFLE_PLATFORM_DEVICE_EGL:
+            return degl_platform_create();
 #endif
         default:
             assert(false);
@@ -0,0 +1,568 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @addtogroup waffle_readback
+/// @{
+
+/// @file
+
+#include <ctype.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "api_priv.h"
+
+#include "wcore_context.h"
+#include "wcore_error.h"
+#include "wcore_tinfo.h"
+#include "wcore_window.h"
+
+// Waffle does not include the GL headers.
+#define GL_PACK_ROW_LENGTH              0x0d02
+#define GL_PACK_SKIP_ROWS               0x0d03
+#define GL_PACK_SKIP_PIXELS             0x0d04
+#define GL_PACK_ALIGNMENT               0x0d05
+#define GL_UNSIGNED_BYTE                0x1401
+#define GL_RGBA                         0x1908
+#define GL_VERSION                      0x1f02
+#define GL_BGRA                         0x80e1
+#define GL_BUFFER_SIZE                  0x8764
+#define GL_STREAM_READ                  0x88e1
+#define GL_PIXEL_PACK_BUFFER            0x88eb
+#define GL_PIXEL_PACK_BUFFER_BINDING    0x88ed
+#define GL_SYNC_GPU_COMMANDS_COMPLETE   0x9117
+#define GL_TIMEOUT_EXPIRED              0x911b
+#define GL_WAIT_FAILED                  0x911d
+#define GL_MAP_READ_BIT                 0x0001
+#define GL_SYNC_FLUSH_COMMANDS_BIT      0x0001
+
+/// The functions used by a readback, resolved when it is created.
+struct readback_gl {
+    void (*BindBuffer)(unsigned int target, unsigned int buffer);
+    void (*BufferData)(unsigned int target, ptrdiff_t size,
+                       const void *data, unsigned int usage);
+    unsigned int (*ClientWaitSync)(void *sync, unsigned int flags,
+                                   uint64_t timeout);
+    void (*DeleteBuffers)(int n, const unsigned int *buffers);
+    void (*DeleteSync)(void *sync);
+    void *(*FenceSync)(unsigned int condition, unsigned int flags);
+    void (*GenBuffers)(int n, unsigned int *buffers);
+    void (*GetBufferParameteri64v)(unsigned int target, unsigned int pname,
+                                   int64_t *data);
+    void (*GetIntegerv)(unsigned int pname, int *data);
+    const unsigned char *(*GetString)(unsigned int name);
+    void *(*MapBufferRange)(unsigned int target, ptrdiff_t offset,
+                            ptrdiff_t length, unsigned int access);
+    void (*PixelStorei)(unsigned int pname, int param);
+    void (*ReadPixels)(int x, int y, int width, int height,
+                       unsigned int format, unsigned int type, void *pixels);
+    unsigned char (*UnmapBuffer)(unsigned int target);
+};
+
+#define READBACK_PROC(name) { "gl" #name, offsetof(struct readback_gl, name) }
+
+static const struct {
+    const char *name;
+    size_t offset;
+} readback_procs[] = {
+    READBACK_PROC(BindBuffer),
+    READBACK_PROC(BufferData),
+    READBACK_PROC(ClientWaitSync),
+    READBACK_PROC(DeleteBuffers),
+    READBACK_PROC(DeleteSync),
+    READBACK_PROC(FenceSync),
+    READBACK_PROC(GenBuffers),
+    READBACK_PROC(GetBufferParameteri64v),
+    READBACK_PROC(GetIntegerv),
+    READBACK_PROC(GetString),
+    READBACK_PROC(MapBufferRange),
+    READBACK_PROC(PixelStorei),
+    READBACK_PROC(ReadPixels),
+    READBACK_PROC(UnmapBuffer),
+};
+
+#undef READBACK_PROC
+
+struct waffle_readback {
+    struct wcore_context *ctx;
+    struct readback_gl gl;
+
+    int32_t width;
+    int32_t height;
+    int32_t format;
+    ptrdiff_t size;
+
+    /// @brief A ring of buffers, each with the fence of its read.
+    ///
+    /// The pending reads occupy the @a num_pending slots that start at
+    /// @a oldest. A mapped slot stays pending until it is unmapped.
+    int32_t depth;
+    unsigned int pbos[WAFFLE_READBACK_MAX_DEPTH];
+    void *fences[WAFFLE_READBACK_MAX_DEPTH];
+    int32_t oldest;
+    int32_t num_pending;
+    bool mapped;
+};
+
+/// @brief The pack state that glReadPixels() depends on.
+///
+/// A readback overrides it for its own reads and restores the
+/// application's values afterwards.
+struct readback_pack_state {
+    int buffer;
+    int alignment;
+    int row_length;
+    int skip_rows;
+    int skip_pixels;
+};
+
+static unsigned int
+readback_get_pack_buffer(struct waffle_readback *self)
+{
+    int buffer = 0;
+    self->gl.GetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &buffer);
+    return buffer;
+}
+
+static void
+readback_save_pack_state(struct waffle_readback *self,
+                         struct readback_pack_state *state)
+{
+    state->buffer = readback_get_pack_buffer(self);
+    self->gl.GetIntegerv(GL_PACK_ALIGNMENT, &state->alignment);
+    self->gl.GetIntegerv(GL_PACK_ROW_LENGTH, &state->row_length);
+    self->gl.GetIntegerv(GL_PACK_SKIP_ROWS, &state->skip_rows);
+    self->gl.GetIntegerv(GL_PACK_SKIP_PIXELS, &state->skip_pixels);
+}
+
+static void
+readback_load_pack_state(struct waffle_readback *self,
+                         const struct readback_pack_state *state)
+{
+    self->gl.BindBuffer(GL_PIXEL_PACK_BUFFER, state->buffer);
+    self->gl.PixelStorei(GL_PACK_ALIGNMENT, state->alignment);
+    self->gl.PixelStorei(GL_PACK_ROW_LENGTH, state->row_length);
+    self->gl.PixelStorei(GL_PACK_SKIP_ROWS, state->skip_rows);
+    self->gl.PixelStorei(GL_PACK_SKIP_PIXELS, state->skip_pixels);
+}
+
+/// @brief Emit an error unless @a self's context is current.
+static bool
+readback_check_current(struct waffle_readback *self)
+{
+    if (wcore_tinfo_get()->current.context != self->ctx) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "the readback's context is not current");
+        return false;
+    }
+
+    return true;
+}
+
+static bool
+readback_check_entry(struct waffle_readback *self)
+{
+    const struct api_object *obj_list[] = {
+        self ? &self->ctx->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    return readback_check_current(self);
+}
+
+/// @brief Check for the GL 3.2 or GLES 3.0 fences and buffer mapping.
+static bool
+readback_check_version(struct waffle_readback *self)
+{
+    const char *version = (const char *) self->gl.GetString(GL_VERSION);
+    bool es = false;
+    int major = 0, minor = 0;
+
+    // ES strings look like "OpenGL ES 3.2 Mesa" or "OpenGL ES-CM 1.1".
+    if (version && strncmp(version, "OpenGL ES", 9) == 0) {
+        es = true;
+        while (*version && !isdigit((unsigned char) *version))
+            ++version;
+    }
+
+    if (!version || sscanf(version, "%d.%d", &major, &minor) != 2) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "failed to parse the GL_VERSION of the context");
+        return false;
+    }
+
+    if (es ? major < 3 : major * 10 + minor < 32) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "asynchronous readback requires OpenGL 3.2 or "
+                     "OpenGL ES 3.0, but the context has %s%d.%d",
+                     es ? "OpenGL ES " : "", major, minor);
+        return false;
+    }
+
+    return true;
+}
+
+struct waffle_readback*
+api_readback_create(struct wcore_context *wc_ctx,
+                    int32_t width,
+                    int32_t height,
+                    int32_t format,
+                    int32_t depth)
+{
+    struct waffle_readback *self;
+    unsigned int app_buffer;
+    int64_t buffer_size = 0;
+    int32_t i;
+
+    if (width <= 0 || height <= 0) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "readback size %dx%d is not positive", width, height);
+        return NULL;
+    }
+
+    if (format != GL_RGBA && format != GL_BGRA) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "readback format must be GL_RGBA or GL_BGRA");
+        return NULL;
+    }
+
+    if (depth < 1 || depth > WAFFLE_READBACK_MAX_DEPTH) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "readback depth must be between 1 and %d",
+                     WAFFLE_READBACK_MAX_DEPTH);
+        return NULL;
+    }
+
+    self = wcore_calloc(sizeof(*self));
+    if (!self)
+        return NULL;
+
+    self->ctx = wc_ctx;
+    self->width = width;
+    self->height = height;
+    self->format = format;
+    self->size = (ptrdiff_t) width * height * 4;
+    self->depth = depth;
+
+    if (!readback_check_current(self))
+        goto error;
+
+    for (size_t i = 0; i < sizeof(readback_procs) / sizeof(readback_procs[0]); ++i) {
+        void *proc = api_resolve_gl_proc(wc_ctx, readback_procs[i].name);
+
+        if (!proc) {
+            wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                         "failed to resolve %s", readback_procs[i].name);
+            goto error;
+        }
+
+        memcpy((char*) &self->gl + readback_procs[i].offset,
+               &proc, sizeof(proc));
+    }
+
+    if (!readback_check_version(self))
+        goto error;
+
+    app_buffer = readback_get_pack_buffer(self);
+
+    // A failed glBufferData() leaves the buffer at its old size, zero. Its
+    // GL error is left for the application.
+    self->gl.GenBuffers(depth, self->pbos);
+    for (i = 0; i < depth; ++i) {
+        self->gl.BindBuffer(GL_PIXEL_PACK_BUFFER, self->pbos[i]);
+        self->gl.BufferData(GL_PIXEL_PACK_BUFFER, self->size, NULL,
+                            GL_STREAM_READ);
+        self->gl.GetBufferParameteri64v(GL_PIXEL_PACK_BUFFER, GL_BUFFER_SIZE,
+                                        &buffer_size);
+        if (buffer_size != self->size)
+            break;
+    }
+    self->gl.BindBuffer(GL_PIXEL_PACK_BUFFER, app_buffer);
+
+    if (i < depth) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "allocating the pixel pack buffers failed");
+        self->gl.DeleteBuffers(depth, self->pbos);
+        goto error;
+    }
+
+    return self;
+
+error:
+    free(self);
+    return NULL;
+}
+
+struct waffle_readback*
+waffle_readback_create(
+        struct waffle_context *ctx,
+        int32_t width,
+        int32_t height,
+        int32_t format,
+        int32_t depth)
+{
+    struct wcore_context *wc_ctx = wcore_context(ctx);
+
+    const struct api_object *obj_list[] = {
+        wc_ctx ? &wc_ctx->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return NULL;
+
+    return api_readback_create(wc_ctx, width, height, format, depth);
+}
+
+void
+api_readback_destroy(struct waffle_readback *self)
+{
+    // Without the context, the buffers and fences are released with it.
+    if (wcore_tinfo_get()->current.context == self->ctx) {
+        if (self->mapped) {
+            unsigned int app_buffer = readback_get_pack_buffer(self);
+
+            self->gl.BindBuffer(GL_PIXEL_PACK_BUFFER, self->pbos[self->oldest]);
+            self->gl.UnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            self->gl.BindBuffer(GL_PIXEL_PACK_BUFFER, app_buffer);
+        }
+
+        for (int32_t i = 0; i < self->depth; ++i) {
+            if (self->fences[i])
+                self->gl.DeleteSync(self->fences[i]);
+        }
+
+        self->gl.DeleteBuffers(self->depth, self->pbos);
+    }
+
+    free(self);
+}
+
+bool
+waffle_readback_destroy(struct waffle_readback *self)
+{
+    const struct api_object *obj_list[] = {
+        self ? &self->ctx->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    api_readback_destroy(self);
+    return true;
+}
+
+bool
+api_readback_begin(struct waffle_readback *self,
+                   struct wcore_window *wc_window)
+{
+    static const struct readback_pack_state tight = {
+        .alignment = 4,
+    };
+    struct readback_pack_state saved;
+    int32_t slot;
+
+    if (!readback_check_current(self))
+        return false;
+
+    if (wcore_tinfo_get()->current.window != wc_window) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "the window is not current");
+        return false;
+    }
+
+    if (self->num_pending == self->depth) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "all %d buffers of the readback are pending; map and "
+                     "unmap the oldest first", self->depth);
+        return false;
+    }
+
+    slot = (self->oldest + self->num_pending) % self->depth;
+
+    readback_save_pack_state(self, &saved);
+
+    // Read into the slot with tightly packed rows. glReadPixels() reports
+    // failure only through glGetError(), which belongs to the application.
+    readback_load_pack_state(self, &tight);
+    self->gl.BindBuffer(GL_PIXEL_PACK_BUFFER, self->pbos[slot]);
+    self->gl.ReadPixels(0, 0, self->width, self->height,
+                        self->format, GL_UNSIGNED_BYTE, NULL);
+
+    readback_load_pack_state(self, &saved);
+
+    self->fences[slot] = self->gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    if (!self->fences[slot]) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "glFenceSync failed");
+        return false;
+    }
+
+    self->num_pending++;
+    return true;
+}
+
+bool
+waffle_readback_begin(
+        struct waffle_readback *self,
+        struct waffle_window *window)
+{
+    struct wcore_window *wc_window = wcore_window(window);
+
+    const struct api_object *obj_list[] = {
+        self ? &self->ctx->api : NULL,
+        wc_window ? &wc_window->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 2))
+        return false;
+
+    return api_readback_begin(self, wc_window);
+}
+
+int32_t
+api_readback_get_num_pending(struct waffle_readback *self)
+{
+    return self->num_pending;
+}
+
+int32_t
+waffle_readback_get_num_pending(struct waffle_readback *self)
+{
+    const struct api_object *obj_list[] = {
+        self ? &self->ctx->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return -1;
+
+    return api_readback_get_num_pending(self);
+}
+
+const void*
+api_readback_map_oldest(struct waffle_readback *self)
+{
+    // Wait in slices so a hung GPU cannot overflow the driver's timeout.
+    const uint64_t timeout_ns = 1000000000;
+    unsigned int flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+    unsigned int status;
+    unsigned int app_buffer;
+    void *fence;
+    void *data;
+
+    if (!readback_check_current(self))
+        return NULL;
+
+    if (self->mapped) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "the oldest buffer of the readback is already mapped");
+        return NULL;
+    }
+
+    if (self->num_pending == 0) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "the readback has no pending buffers");
+        return NULL;
+    }
+
+    fence = self->fences[self->oldest];
+    do {
+        status = self->gl.ClientWaitSync(fence, flags, timeout_ns);
+        flags = 0;
+    } while (status == GL_TIMEOUT_EXPIRED);
+
+    if (status == GL_WAIT_FAILED) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "glClientWaitSync failed");
+        return NULL;
+    }
+
+    app_buffer = readback_get_pack_buffer(self);
+
+    self->gl.BindBuffer(GL_PIXEL_PACK_BUFFER, self->pbos[self->oldest]);
+    data = self->gl.MapBufferRange(GL_PIXEL_PACK_BUFFER, 0, self->size,
+                                   GL_MAP_READ_BIT);
+    self->gl.BindBuffer(GL_PIXEL_PACK_BUFFER, app_buffer);
+
+    if (!data) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "glMapBufferRange failed");
+        return NULL;
+    }
+
+    self->mapped = true;
+    return data;
+}
+
+const void*
+waffle_readback_map_oldest(struct waffle_readback *self)
+{
+    if (!readback_check_entry(self))
+        return NULL;
+
+    return api_readback_map_oldest(self);
+}
+
+bool
+api_readback_unmap(struct waffle_readback *self)
+{
+    unsigned int app_buffer;
+    int32_t slot;
+
+    if (!readback_check_current(self))
+        return false;
+
+    if (!self->mapped) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "the readback has no mapped buffer");
+        return false;
+    }
+
+    slot = self->oldest;
+
+    app_buffer = readback_get_pack_buffer(self);
+    self->gl.BindBuffer(GL_PIXEL_PACK_BUFFER, self->pbos[slot]);
+    self->gl.UnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    self->gl.BindBuffer(GL_PIXEL_PACK_BUFFER, app_buffer);
+
+    self->gl.DeleteSync(self->fences[slot]);
+    self->fences[slot] = NULL;
+
+    self->oldest = (slot + 1) % self->depth;
+    self->num_pending--;
+    self->mapped = false;
+    return true;
+}
+
+bool
+waffle_readback_unmap(struct waffle_readback *self)
+{
+    if (!readback_check_entry(self))
+        return false;
+
+    return api_readback_unmap(self);
+}
+
+/// @}
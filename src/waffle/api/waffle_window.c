@@ -37,6 +37,20 @@
 #include "wcore_platform.h"
 #include "wcore_window.h"
 
+/// @brief Check that the config has a native config to create surfaces with.
+static bool
+check_config_has_surfaces(struct wcore_config *wc_config)
+{
+    if (wc_config->attrs.context_no_config) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "cannot create a window from a config chosen with "
+                     "WAFFLE_CONTEXT_NO_CONFIG");
+        return false;
+    }
+
+    return true;
+}
+
 struct waffle_window*
 waffle_window_create(
         struct waffle_config *config,
@@ -52,6 +66,9 @@ waffle_window_create(
     if (!api_check_entry(obj_list, 1))
         return NULL;
 
+    if (!check_config_has_surfaces(wc_config))
+        return NULL;
+
     wc_self = api_platform->vtbl->window.create(api_platform,
                                                 wc_config,
                                                 width,
@@ -59,6 +76,54 @@ waffle_window_create(
     if (!wc_self)
         return NULL;
 
+    wc_self->width = width;
+    wc_self->height = height;
+    return &wc_self->wfl;
+}
+
+struct waffle_window*
+waffle_window_create_with_modifiers(
+        struct waffle_config *config,
+        int32_t width,
+        int32_t height,
+        const uint64_t *modifiers,
+        int32_t num_modifiers)
+{
+    struct wcore_window *wc_self;
+    struct wcore_config *wc_config = wcore_config(config);
+
+    const struct api_object *obj_list[] = {
+        wc_config ? &wc_config->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return NULL;
+
+    if (!check_config_has_surfaces(wc_config))
+        return NULL;
+
+    if (num_modifiers < 0 || (num_modifiers > 0 && modifiers == NULL)) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "modifiers must hold num_modifiers >= 0 elements");
+        return NULL;
+    }
+
+    if (!api_platform->vtbl->window.create_with_modifiers) {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return NULL;
+    }
+
+    wc_self = api_platform->vtbl->window.create_with_modifiers(api_platform,
+                                                               wc_config,
+                                                               width,
+                                                               height,
+                                                               modifiers,
+                                                               num_modifiers);
+    if (!wc_self)
+        return NULL;
+
+    wc_self->width = width;
+    wc_self->height = height;
     return &wc_self->wfl;
 }
 
@@ -66,6 +131,7 @@ bool
 waffle_window_destroy(struct waffle_window *self)
 {
     struct wcore_window *wc_self = wcore_window(self);
+    bool ok = true;
 
     const struct api_object *obj_list[] = {
         wc_self ? &wc_self->api : NULL,
@@ -74,7 +140,13 @@ waffle_window_destroy(struct waffle_window *self)
     if (!api_check_entry(obj_list, 1))
         return false;
 
-    return api_platform->vtbl->window.destroy(wc_self);
+    // Destroy the window even if the capture's last frames were lost.
+    if (wc_self->capture)
+        ok &= api_capture_detach(wc_self->capture);
+
+    api_forget_current(wc_self);
+    ok &= api_platform->vtbl->window.destroy(wc_self);
+    return ok;
 }
 
 bool
@@ -107,8 +179,20 @@ waffle_window_resize(
     if (!api_check_entry(obj_list, 1))
         return false;
 
+    // The capture's sink receives frames of the size at attach.
+    if (wc_self->capture) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "detach the window's capture before resizing it");
+        return false;
+    }
+
     if (api_platform->vtbl->window.resize) {
-        return api_platform->vtbl->window.resize(wc_self, width, height);
+        if (!api_platform->vtbl->window.resize(wc_self, width, height))
+            return false;
+
+        wc_self->width = width;
+        wc_self->height = height;
+        return true;
     }
     else {
         wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
@@ -116,6 +200,263 @@ waffle_window_resize(
     }
 }
 
+/// @brief Validate an array of x, y, width, height damage rectangles.
+static bool
+check_damage_rects(const int32_t *rects, int32_t n_rects)
+{
+    if (n_rects < 0) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "n_rects is negative");
+        return false;
+    }
+
+    if (n_rects > 0 && rects == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "rects is null but n_rects is %d", n_rects);
+        return false;
+    }
+
+    for (int32_t i = 0; i < n_rects; ++i) {
+        if (rects[4 * i + 2] < 0 || rects[4 * i + 3] < 0) {
+            wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                         "damage rectangle %d has a negative size", i);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool
+waffle_window_swap_buffers_with_damage(
+		struct waffle_window *self,
+		const int32_t *rects,
+		int32_t n_rects)
+{
+    struct wcore_window *wc_self = wcore_window(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (!check_damage_rects(rects, n_rects))
+        return false;
+
+    if (wc_self->capture)
+        api_capture_frame(wc_self->capture);
+
+    if (api_platform->vtbl->window.swap_buffers_with_damage) {
+        return api_platform->vtbl->window.swap_buffers_with_damage(wc_self,
+                                                                   rects,
+                                                                   n_rects);
+    }
+    else {
+        return api_platform->vtbl->window.swap_buffers(wc_self);
+    }
+}
+
+bool
+waffle_window_get_buffer_age(
+		struct waffle_window *self,
+		int32_t *age)
+{
+    struct wcore_window *wc_self = wcore_window(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (age == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "age is null");
+        return false;
+    }
+
+    if (api_platform->vtbl->window.get_buffer_age) {
+        return api_platform->vtbl->window.get_buffer_age(wc_self, age);
+    }
+    else {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
+}
+
+bool
+waffle_window_set_damage_region(
+		struct waffle_window *self,
+		const int32_t *rects,
+		int32_t n_rects)
+{
+    struct wcore_window *wc_self = wcore_window(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (!check_damage_rects(rects, n_rects))
+        return false;
+
+    if (api_platform->vtbl->window.set_damage_region) {
+        return api_platform->vtbl->window.set_damage_region(wc_self,
+                                                            rects,
+                                                            n_rects);
+    }
+    else {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
+}
+
+bool
+waffle_window_set_render_buffer(
+		struct waffle_window *self,
+		int32_t buffer)
+{
+    struct wcore_window *wc_self = wcore_window(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (buffer != WAFFLE_RENDER_BUFFER_BACK &&
+        buffer != WAFFLE_RENDER_BUFFER_SINGLE) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "buffer has bad value 0x%x", buffer);
+        return false;
+    }
+
+    if (api_platform->vtbl->window.set_render_buffer) {
+        return api_platform->vtbl->window.set_render_buffer(wc_self, buffer);
+    }
+    else {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
+}
+
+bool
+waffle_window_set_front_buffer_callback(
+		struct waffle_window *self,
+		waffle_front_buffer_func func,
+		void *user_data)
+{
+    struct wcore_window *wc_self = wcore_window(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (api_platform->vtbl->window.set_front_buffer_callback) {
+        return api_platform->vtbl->window.set_front_buffer_callback(wc_self,
+                                                                    func,
+                                                                    user_data);
+    }
+    else {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
+}
+
+bool
+waffle_window_release_front_buffer(
+		struct waffle_window *self,
+		void *buffer)
+{
+    struct wcore_window *wc_self = wcore_window(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (buffer == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "buffer is null");
+        return false;
+    }
+
+    if (api_platform->vtbl->window.release_front_buffer) {
+        return api_platform->vtbl->window.release_front_buffer(wc_self,
+                                                               buffer);
+    }
+    else {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
+}
+
+bool
+waffle_window_export_dmabuf(
+		struct waffle_window *self,
+		struct waffle_dmabuf *dmabuf)
+{
+    struct wcore_window *wc_self = wcore_window(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (dmabuf == NULL) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER, "dmabuf is null");
+        return false;
+    }
+
+    if (api_platform->vtbl->window.export_dmabuf) {
+        return api_platform->vtbl->window.export_dmabuf(wc_self, dmabuf);
+    }
+    else {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
+}
+
+bool
+waffle_window_set_swap_interval(
+		struct waffle_window *self,
+		int32_t interval)
+{
+    struct wcore_window *wc_self = wcore_window(self);
+
+    const struct api_object *obj_list[] = {
+        wc_self ? &wc_self->api : NULL,
+    };
+
+    if (!api_check_entry(obj_list, 1))
+        return false;
+
+    if (interval < -1) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "swap interval must be >= -1");
+        return false;
+    }
+
+    if (api_platform->vtbl->window.set_swap_interval) {
+        return api_platform->vtbl->window.set_swap_interval(wc_self,
+                                                            interval);
+    }
+    else {
+        wcore_error(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        return false;
+    }
+}
+
 bool
 waffle_window_swap_buffers(struct waffle_window *self)
 {
@@ -128,6 +469,9 @@ waffle_window_swap_buffers(struct waffle_window *self)
     if (!api_check_entry(obj_list, 1))
         return false;
 
+    if (wc_self->capture)
+        api_capture_frame(wc_self->capture);
+
     return api_platform->vtbl->window.swap_buffers(wc_self);
 }
 
@@ -76,6 +76,43 @@ cgl_config_check_attrs(const struct cgl_platform *plat,
         return false;
     }
 
+    if (attrs->context_no_error) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "CGL does not support no-error contexts");
+        return false;
+    }
+
+    if (attrs->context_release_behavior == WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "CGL does not support contexts that do not flush on "
+                     "release");
+        return false;
+    }
+
+    if (attrs->context_priority != WAFFLE_DONT_CARE) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "CGL does not support context priorities");
+        return false;
+    }
+
+    if (attrs->color_format != WAFFLE_DONT_CARE) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "CGL does not support explicit color formats");
+        return false;
+    }
+
+    if (attrs->mutable_render_buffer) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "CGL does not support mutable render buffers");
+        return false;
+    }
+
+    if (attrs->context_no_config) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "CGL does not support contexts without a config");
+        return false;
+    }
+
     // Emulate EGL_KHR_create_context, which allows the implementation to
     // return a context of the latest supported flavor that is
     // backwards-compatibile with the requested flavor.
@@ -213,6 +250,11 @@ cgl_config_fill_pixel_format_attrs(
     if (attrs->double_buffered)
         pixel_attrs[i++] = kCGLPFADoubleBuffer;
 
+    // CGL ranks the pixel formats itself; ask it for the closest sizes
+    // rather than the largest.
+    if (attrs->config_selection == WAFFLE_CONFIG_SELECTION_SMALLEST)
+        pixel_attrs[i++] = kCGLPFAClosestPolicy;
+
     pixel_attrs[i++] = 0;
 
     #undef ADD_ATTR
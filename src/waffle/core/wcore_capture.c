@@ -0,0 +1,540 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define _POSIX_C_SOURCE 200809L // glibc feature macro for ftruncate()
+
+#include <assert.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/mman.h>
+
+#include "wcore_capture.h"
+#include "wcore_error.h"
+#include "wcore_util.h"
+
+enum {
+    /// Offset of the first slot, and of the pixels within a slot.
+    RING_ALIGN = 64,
+
+    /// Bounds the preallocated queue memory.
+    MAX_QUEUE_DEPTH = 64,
+};
+
+static bool
+write_all(int fd, const void *buf, size_t size)
+{
+    const uint8_t *p = buf;
+
+    while (size > 0) {
+        ssize_t n = write(fd, p, size);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+
+        p += n;
+        size -= n;
+    }
+
+    return true;
+}
+
+static size_t
+ring_slot_size(const struct wcore_capture *self)
+{
+    return (RING_ALIGN + self->frame_size + RING_ALIGN - 1)
+           & ~(size_t) (RING_ALIGN - 1);
+}
+
+static uint8_t*
+ring_slot(const struct wcore_capture *self, uint32_t i)
+{
+    return (uint8_t*) self->ring + self->ring->slot_offset
+           + (size_t) i * self->ring->slot_size;
+}
+
+static void
+flip_rows(const struct wcore_capture *self, uint8_t *dst, const uint8_t *src)
+{
+    const size_t stride = (size_t) self->opts.width * 4;
+
+    for (int32_t y = 0; y < self->opts.height; ++y) {
+        memcpy(dst + y * stride,
+               src + (self->opts.height - 1 - y) * stride,
+               stride);
+    }
+}
+
+// Full-range RGB to limited-range BT.601 YCbCr, as most players expect of
+// a Y4M stream without a colorspace tag.
+static void
+convert_to_y4m(const struct wcore_capture *self, uint8_t *dst,
+               const uint8_t *src)
+{
+    const size_t stride = (size_t) self->opts.width * 4;
+    const size_t plane_size = (size_t) self->opts.width * self->opts.height;
+    uint8_t *y_plane = dst;
+    uint8_t *u_plane = y_plane + plane_size;
+    uint8_t *v_plane = u_plane + plane_size;
+
+    for (int32_t y = 0; y < self->opts.height; ++y) {
+        const uint8_t *row = src + (self->opts.height - 1 - y) * stride;
+
+        for (int32_t x = 0; x < self->opts.width; ++x) {
+            const int r = row[4 * x + 0];
+            const int g = row[4 * x + 1];
+            const int b = row[4 * x + 2];
+
+            *y_plane++ = (( 66 * r + 129 * g +  25 * b + 128) >> 8) + 16;
+            *u_plane++ = ((-38 * r -  74 * g + 112 * b + 128) >> 8) + 128;
+            *v_plane++ = ((112 * r -  94 * g -  18 * b + 128) >> 8) + 128;
+        }
+    }
+}
+
+static void
+ring_write(struct wcore_capture *self, const uint8_t *frame,
+           uint64_t frame_number)
+{
+    struct waffle_capture_ring *ring = self->ring;
+    uint8_t *slot = ring_slot(self, (frame_number - 1) % ring->num_slots);
+    uint64_t *slot_frame = (uint64_t*) slot;
+
+    // A reader that copies the slot while it is rewritten sees its frame
+    // number change.
+    __atomic_store_n(slot_frame, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    flip_rows(self, slot + RING_ALIGN, frame);
+
+    __atomic_store_n(slot_frame, frame_number, __ATOMIC_RELEASE);
+    __atomic_store_n(&ring->frames_written, frame_number, __ATOMIC_RELEASE);
+}
+
+/// @return 0 or an errno.
+static int
+write_frame(struct wcore_capture *self, const uint8_t *frame,
+            uint64_t frame_number)
+{
+    static const char y4m_frame_header[] = "FRAME\n";
+
+    if (self->opts.sink == WAFFLE_CAPTURE_SINK_SHM_RING) {
+        ring_write(self, frame, frame_number);
+        return 0;
+    }
+
+    if (self->opts.format == WAFFLE_CAPTURE_FORMAT_Y4M) {
+        const size_t header_size = sizeof(y4m_frame_header) - 1;
+
+        memcpy(self->staging, y4m_frame_header, header_size);
+        convert_to_y4m(self, self->staging + header_size, frame);
+    } else {
+        flip_rows(self, self->staging, frame);
+    }
+
+    if (!write_all(self->opts.fd, self->staging, self->staging_size))
+        return errno;
+
+    return 0;
+}
+
+static void*
+writer_main(void *arg)
+{
+    struct wcore_capture *self = arg;
+
+    pthread_mutex_lock(&self->mutex);
+
+    while (true) {
+        while (self->count == 0 && !self->stopping)
+            pthread_cond_wait(&self->not_empty, &self->mutex);
+
+        if (self->count == 0)
+            break;
+
+        const uint8_t *frame = self->frames[self->head];
+        const uint64_t frame_number = self->stats.frames_written + 1;
+        int error = self->stats.write_error;
+
+        // The producer fills only free buffers, so the head buffer may be
+        // read without the lock.
+        if (!error) {
+            pthread_mutex_unlock(&self->mutex);
+            error = write_frame(self, frame, frame_number);
+            pthread_mutex_lock(&self->mutex);
+        }
+
+        if (error) {
+            self->stats.write_error = error;
+            self->stats.frames_dropped++;
+        } else {
+            self->stats.frames_written++;
+        }
+
+        self->head = (self->head + 1) % self->opts.queue_depth;
+        self->count--;
+        pthread_cond_signal(&self->not_full);
+    }
+
+    pthread_mutex_unlock(&self->mutex);
+    return NULL;
+}
+
+static bool
+check_options(const struct wcore_capture_options *opts)
+{
+    if (opts->fd < 0) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "WAFFLE_CAPTURE_FD must be a file descriptor");
+        return false;
+    }
+
+    switch (opts->sink) {
+        case WAFFLE_CAPTURE_SINK_STREAM:
+        case WAFFLE_CAPTURE_SINK_SHM_RING:
+            break;
+        default:
+            wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                         "WAFFLE_CAPTURE_SINK has bad value 0x%x",
+                         opts->sink);
+            return false;
+    }
+
+    switch (opts->format) {
+        case WAFFLE_CAPTURE_FORMAT_RAW:
+            break;
+        case WAFFLE_CAPTURE_FORMAT_Y4M:
+            if (opts->sink == WAFFLE_CAPTURE_SINK_SHM_RING) {
+                wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                             "WAFFLE_CAPTURE_SINK_SHM_RING requires "
+                             "WAFFLE_CAPTURE_FORMAT_RAW");
+                return false;
+            }
+            break;
+        default:
+            wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                         "WAFFLE_CAPTURE_FORMAT has bad value 0x%x",
+                         opts->format);
+            return false;
+    }
+
+    switch (opts->policy) {
+        case WAFFLE_CAPTURE_POLICY_BLOCK:
+        case WAFFLE_CAPTURE_POLICY_DROP:
+            break;
+        default:
+            wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                         "WAFFLE_CAPTURE_POLICY has bad value 0x%x",
+                         opts->policy);
+            return false;
+    }
+
+    if (opts->queue_depth < 1 || opts->queue_depth > MAX_QUEUE_DEPTH) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "WAFFLE_CAPTURE_QUEUE_DEPTH must be in [1, %d]",
+                     MAX_QUEUE_DEPTH);
+        return false;
+    }
+
+    if (opts->ring_slots < 1) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "WAFFLE_CAPTURE_RING_SLOTS must be positive");
+        return false;
+    }
+
+    if (opts->frame_rate < 1) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "WAFFLE_CAPTURE_FRAME_RATE must be positive");
+        return false;
+    }
+
+    // Keep the ring's offsets within its uint32_t fields.
+    if (opts->width < 1 || opts->height < 1 ||
+        (uint64_t) opts->width * opts->height * 4 > INT32_MAX) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "cannot capture a %dx%d window",
+                     opts->width, opts->height);
+        return false;
+    }
+
+    return true;
+}
+
+static bool
+ring_map(struct wcore_capture *self)
+{
+    const size_t slot_size = ring_slot_size(self);
+    struct waffle_capture_ring *ring;
+
+    if ((uint64_t) slot_size * self->opts.ring_slots > INT32_MAX) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "WAFFLE_CAPTURE_RING_SLOTS is too large");
+        return false;
+    }
+
+    self->ring_size = RING_ALIGN + slot_size * self->opts.ring_slots;
+
+    if (ftruncate(self->opts.fd, self->ring_size) != 0) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "ftruncate of capture ring failed: %s", strerror(errno));
+        return false;
+    }
+
+    ring = mmap(NULL, self->ring_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                self->opts.fd, 0);
+    if (ring == MAP_FAILED) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "mmap of capture ring failed: %s", strerror(errno));
+        return false;
+    }
+
+    self->ring = ring;
+    ring->num_slots = self->opts.ring_slots;
+    ring->width = self->opts.width;
+    ring->height = self->opts.height;
+    ring->stride = self->opts.width * 4;
+    ring->slot_offset = RING_ALIGN;
+    ring->slot_size = slot_size;
+    ring->reserved = 0;
+    ring->frames_written = 0;
+
+    for (uint32_t i = 0; i < ring->num_slots; ++i)
+        *(uint64_t*) ring_slot(self, i) = 0;
+
+    // Readers check the magic last, so publish it last.
+    __atomic_store_n(&ring->magic, WAFFLE_CAPTURE_RING_MAGIC,
+                     __ATOMIC_RELEASE);
+    return true;
+}
+
+static bool
+write_y4m_header(struct wcore_capture *self)
+{
+    char header[128];
+    int len;
+
+    len = snprintf(header, sizeof(header),
+                   "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C444\n",
+                   self->opts.width, self->opts.height,
+                   self->opts.frame_rate);
+
+    if (!write_all(self->opts.fd, header, len)) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "writing the Y4M header failed: %s", strerror(errno));
+        return false;
+    }
+
+    return true;
+}
+
+static void
+free_buffers(struct wcore_capture *self)
+{
+    if (self->ring)
+        munmap(self->ring, self->ring_size);
+
+    if (self->frames) {
+        for (int32_t i = 0; i < self->opts.queue_depth; ++i)
+            free(self->frames[i]);
+    }
+
+    free(self->frames);
+    free(self->staging);
+}
+
+struct wcore_capture*
+wcore_capture_create(const struct wcore_capture_options *opts)
+{
+    struct wcore_capture *self;
+    int error;
+
+    assert(opts);
+
+    if (!check_options(opts))
+        return NULL;
+
+    self = wcore_calloc(sizeof(*self));
+    if (!self)
+        return NULL;
+
+    self->opts = *opts;
+    self->frame_size = (size_t) opts->width * opts->height * 4;
+
+    self->frames = wcore_calloc(opts->queue_depth * sizeof(self->frames[0]));
+    if (!self->frames)
+        goto error;
+
+    for (int32_t i = 0; i < opts->queue_depth; ++i) {
+        self->frames[i] = wcore_malloc(self->frame_size);
+        if (!self->frames[i])
+            goto error;
+    }
+
+    if (opts->sink == WAFFLE_CAPTURE_SINK_SHM_RING) {
+        if (!ring_map(self))
+            goto error;
+    } else {
+        if (opts->format == WAFFLE_CAPTURE_FORMAT_Y4M) {
+            self->staging_size = strlen("FRAME\n")
+                               + (size_t) opts->width * opts->height * 3;
+        } else {
+            self->staging_size = self->frame_size;
+        }
+
+        self->staging = wcore_malloc(self->staging_size);
+        if (!self->staging)
+            goto error;
+
+        if (opts->format == WAFFLE_CAPTURE_FORMAT_Y4M &&
+            !write_y4m_header(self))
+            goto error;
+    }
+
+    pthread_mutex_init(&self->mutex, NULL);
+    pthread_cond_init(&self->not_empty, NULL);
+    pthread_cond_init(&self->not_full, NULL);
+
+    error = pthread_create(&self->thread, NULL, writer_main, self);
+    if (error) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "pthread_create failed: %s", strerror(error));
+        pthread_cond_destroy(&self->not_full);
+        pthread_cond_destroy(&self->not_empty);
+        pthread_mutex_destroy(&self->mutex);
+        goto error;
+    }
+
+    return self;
+
+error:
+    free_buffers(self);
+    free(self);
+    return NULL;
+}
+
+bool
+wcore_capture_destroy(struct wcore_capture *self)
+{
+    int write_error;
+
+    if (!self)
+        return true;
+
+    pthread_mutex_lock(&self->mutex);
+    self->stopping = true;
+    pthread_cond_signal(&self->not_empty);
+    pthread_mutex_unlock(&self->mutex);
+
+    pthread_join(self->thread, NULL);
+
+    write_error = self->stats.write_error;
+
+    pthread_cond_destroy(&self->not_full);
+    pthread_cond_destroy(&self->not_empty);
+    pthread_mutex_destroy(&self->mutex);
+    free_buffers(self);
+    free(self);
+
+    if (write_error) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "writing captured frames failed: %s",
+                     strerror(write_error));
+        return false;
+    }
+
+    return true;
+}
+
+bool
+wcore_capture_push(struct wcore_capture *self, const void *pixels)
+{
+    uint8_t *frame;
+
+    assert(self);
+    assert(pixels);
+
+    pthread_mutex_lock(&self->mutex);
+
+    self->stats.frames_captured++;
+
+    if (self->opts.policy == WAFFLE_CAPTURE_POLICY_BLOCK) {
+        while (self->count == self->opts.queue_depth &&
+               !self->stats.write_error)
+            pthread_cond_wait(&self->not_full, &self->mutex);
+    }
+
+    // After a failed write, drop frames rather than block on a writer that
+    // discards them.
+    if (self->count == self->opts.queue_depth || self->stats.write_error) {
+        self->stats.frames_dropped++;
+        pthread_mutex_unlock(&self->mutex);
+        return false;
+    }
+
+    frame = self->frames[(self->head + self->count) % self->opts.queue_depth];
+    pthread_mutex_unlock(&self->mutex);
+
+    // The writer does not touch a buffer until it is counted.
+    memcpy(frame, pixels, self->frame_size);
+
+    pthread_mutex_lock(&self->mutex);
+    self->count++;
+    if (self->count > self->stats.max_queue_depth)
+        self->stats.max_queue_depth = self->count;
+    pthread_cond_signal(&self->not_empty);
+    pthread_mutex_unlock(&self->mutex);
+
+    return true;
+}
+
+void
+wcore_capture_count_dropped(struct wcore_capture *self, int32_t n)
+{
+    assert(self);
+    assert(n >= 0);
+
+    pthread_mutex_lock(&self->mutex);
+    self->stats.frames_captured += n;
+    self->stats.frames_dropped += n;
+    pthread_mutex_unlock(&self->mutex);
+}
+
+void
+wcore_capture_get_stats(struct wcore_capture *self,
+                        struct waffle_capture_stats *stats)
+{
+    assert(self);
+    assert(stats);
+
+    pthread_mutex_lock(&self->mutex);
+    *stats = self->stats;
+    stats->queue_depth = self->count;
+    pthread_mutex_unlock(&self->mutex);
+}
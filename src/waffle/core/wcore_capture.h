@@ -0,0 +1,128 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @defgroup wcore_capture wcore_capture
+/// @ingroup wcore
+///
+/// @brief A bounded frame queue drained by a writer thread.
+///
+/// One producer pushes RGBA frames, stored bottom-up as glReadPixels()
+/// returns them. A writer thread converts each frame and writes it to a
+/// file descriptor as raw RGBA or Y4M, or copies it into a ring mapped from
+/// a shared memory object. Frame buffers are allocated once, when the
+/// capture is created.
+/// @{
+
+/// @file
+
+#pragma once
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "waffle.h"
+
+struct wcore_capture_options {
+    /// @brief Borrowed; the capture does not close it.
+    int fd;
+
+    /// @brief One of `WAFFLE_CAPTURE_SINK_*`.
+    int32_t sink;
+
+    /// @brief One of `WAFFLE_CAPTURE_FORMAT_*`. Only raw suits a ring.
+    int32_t format;
+
+    /// @brief One of `WAFFLE_CAPTURE_POLICY_*`.
+    int32_t policy;
+
+    int32_t width;
+    int32_t height;
+    int32_t queue_depth;
+    int32_t ring_slots;
+    int32_t frame_rate;
+};
+
+struct wcore_capture {
+    struct wcore_capture_options opts;
+    size_t frame_size;
+
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+
+    /// @brief The queue, a ring of `opts.queue_depth` frame buffers.
+    ///
+    /// The @a count frames starting at @a head are queued. The writer owns
+    /// the head frame until it has written it.
+    uint8_t **frames;
+    int32_t head;
+    int32_t count;
+    bool stopping;
+
+    /// @brief Converted output of the writer thread.
+    uint8_t *staging;
+    size_t staging_size;
+
+    /// @brief The mapping of a WAFFLE_CAPTURE_SINK_SHM_RING.
+    struct waffle_capture_ring *ring;
+    size_t ring_size;
+
+    struct waffle_capture_stats stats;
+};
+
+/// @brief Validate @a opts, allocate the queue, and start the writer.
+///
+/// For a ring, size the shared memory object and write its header.
+struct wcore_capture*
+wcore_capture_create(const struct wcore_capture_options *opts);
+
+/// @brief Write the queued frames, then stop the writer and free @a self.
+///
+/// @return false, and emit an error, if any write failed.
+bool
+wcore_capture_destroy(struct wcore_capture *self);
+
+/// @brief Queue a copy of a frame of `width * height` RGBA pixels.
+///
+/// If the queue is full, wait for the writer under
+/// WAFFLE_CAPTURE_POLICY_BLOCK, or drop the frame under
+/// WAFFLE_CAPTURE_POLICY_DROP. Only one thread may push.
+///
+/// @return true if the frame was queued.
+bool
+wcore_capture_push(struct wcore_capture *self, const void *pixels);
+
+/// @brief Count @a n frames that were lost before reaching the queue.
+void
+wcore_capture_count_dropped(struct wcore_capture *self, int32_t n);
+
+void
+wcore_capture_get_stats(struct wcore_capture *self,
+                        struct waffle_capture_stats *stats);
+
+/// @}
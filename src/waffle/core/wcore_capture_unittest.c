@@ -0,0 +1,285 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/mman.h>
+
+#include <cmocka.h>
+
+#include "waffle.h"
+
+#include "wcore_capture.h"
+#include "wcore_error.h"
+
+// Two RGBA rows of two pixels, bottom row first as glReadPixels returns them.
+static const uint8_t frame_2x2[16] = {
+    0xff, 0x00, 0x00, 0xff,   0x00, 0xff, 0x00, 0xff,    // bottom
+    0x00, 0x00, 0xff, 0xff,   0xff, 0xff, 0xff, 0xff,    // top
+};
+
+static struct wcore_capture_options
+default_options(int fd, int32_t width, int32_t height)
+{
+    struct wcore_capture_options opts = {
+        .fd = fd,
+        .sink = WAFFLE_CAPTURE_SINK_STREAM,
+        .format = WAFFLE_CAPTURE_FORMAT_RAW,
+        .policy = WAFFLE_CAPTURE_POLICY_BLOCK,
+        .width = width,
+        .height = height,
+        .queue_depth = 4,
+        .ring_slots = 4,
+        .frame_rate = 30,
+    };
+
+    return opts;
+}
+
+static size_t
+read_file(FILE *file, uint8_t *buf, size_t size)
+{
+    rewind(file);
+    return fread(buf, 1, size, file);
+}
+
+static void
+test_wcore_capture_raw_flips_rows(void **state) {
+    FILE *file = tmpfile();
+    struct wcore_capture_options opts = default_options(fileno(file), 2, 2);
+    struct wcore_capture *capture;
+    struct waffle_capture_stats stats;
+    uint8_t out[64];
+
+    wcore_error_reset();
+    capture = wcore_capture_create(&opts);
+    assert_true(capture);
+
+    assert_true(wcore_capture_push(capture, frame_2x2));
+    assert_true(wcore_capture_push(capture, frame_2x2));
+
+    wcore_capture_get_stats(capture, &stats);
+    assert_int_equal(stats.frames_captured, 2);
+    assert_int_equal(stats.frames_dropped, 0);
+
+    assert_true(wcore_capture_destroy(capture));
+
+    assert_int_equal(read_file(file, out, sizeof(out)), 32);
+    assert_memory_equal(out + 0, frame_2x2 + 8, 8);
+    assert_memory_equal(out + 8, frame_2x2 + 0, 8);
+    assert_memory_equal(out + 16, out, 16);
+
+    fclose(file);
+}
+
+static void
+test_wcore_capture_y4m(void **state) {
+    static const char header[] = "YUV4MPEG2 W2 H2 F60:1 Ip A1:1 C444\n";
+    FILE *file = tmpfile();
+    struct wcore_capture_options opts = default_options(fileno(file), 2, 2);
+    struct wcore_capture *capture;
+    uint8_t out[128];
+    const uint8_t *planes;
+
+    opts.format = WAFFLE_CAPTURE_FORMAT_Y4M;
+    opts.frame_rate = 60;
+
+    wcore_error_reset();
+    capture = wcore_capture_create(&opts);
+    assert_true(capture);
+    assert_true(wcore_capture_push(capture, frame_2x2));
+    assert_true(wcore_capture_destroy(capture));
+
+    assert_int_equal(read_file(file, out, sizeof(out)),
+                     strlen(header) + strlen("FRAME\n") + 12);
+    assert_memory_equal(out, header, strlen(header));
+    assert_memory_equal(out + strlen(header), "FRAME\n", 6);
+
+    // Top row first: blue, white; then red, green.
+    planes = out + strlen(header) + 6;
+    assert_int_equal(planes[0], 41);    // Y of blue
+    assert_int_equal(planes[1], 235);   // Y of white
+    assert_int_equal(planes[2], 82);    // Y of red
+    assert_int_equal(planes[3], 144);   // Y of green
+    assert_int_equal(planes[4 + 1], 128);
+    assert_int_equal(planes[8 + 1], 128);
+    assert_int_equal(planes[4 + 0], 240);   // U of blue
+    assert_int_equal(planes[8 + 2], 240);   // V of red
+
+    fclose(file);
+}
+
+static void
+test_wcore_capture_drop_when_full(void **state) {
+    // Large enough that the writer blocks on the unread pipe.
+    const int32_t size = 256;
+    const size_t frame_size = (size_t) size * size * 4;
+    struct wcore_capture_options opts;
+    struct wcore_capture *capture;
+    struct waffle_capture_stats stats;
+    uint8_t *frame = calloc(1, frame_size);
+    size_t total = 0;
+    int fds[2];
+
+    assert_int_equal(pipe(fds), 0);
+
+    opts = default_options(fds[1], size, size);
+    opts.policy = WAFFLE_CAPTURE_POLICY_DROP;
+    opts.queue_depth = 1;
+
+    wcore_error_reset();
+    capture = wcore_capture_create(&opts);
+    assert_true(capture);
+
+    assert_true(wcore_capture_push(capture, frame));
+    assert_false(wcore_capture_push(capture, frame));
+    wcore_capture_count_dropped(capture, 2);
+
+    wcore_capture_get_stats(capture, &stats);
+    assert_int_equal(stats.frames_captured, 4);
+    assert_int_equal(stats.frames_dropped, 3);
+    assert_int_equal(stats.max_queue_depth, 1);
+
+    while (total < frame_size) {
+        ssize_t n = read(fds[0], frame, frame_size - total);
+        assert_true(n > 0);
+        total += n;
+    }
+
+    assert_true(wcore_capture_destroy(capture));
+    close(fds[0]);
+    close(fds[1]);
+    free(frame);
+}
+
+static void
+test_wcore_capture_shm_ring(void **state) {
+    FILE *file = tmpfile();
+    struct wcore_capture_options opts = default_options(fileno(file), 2, 2);
+    struct wcore_capture *capture;
+    const struct waffle_capture_ring *ring;
+    const uint8_t *map;
+    size_t map_size;
+
+    opts.sink = WAFFLE_CAPTURE_SINK_SHM_RING;
+    opts.ring_slots = 2;
+
+    wcore_error_reset();
+    capture = wcore_capture_create(&opts);
+    assert_true(capture);
+    for (int i = 0; i < 3; ++i)
+        assert_true(wcore_capture_push(capture, frame_2x2));
+    assert_true(wcore_capture_destroy(capture));
+
+    map_size = lseek(fileno(file), 0, SEEK_END);
+    map = mmap(NULL, map_size, PROT_READ, MAP_SHARED, fileno(file), 0);
+    assert_true(map != MAP_FAILED);
+    ring = (const void*) map;
+
+    assert_int_equal(ring->magic, WAFFLE_CAPTURE_RING_MAGIC);
+    assert_int_equal(ring->num_slots, 2);
+    assert_int_equal(ring->width, 2);
+    assert_int_equal(ring->height, 2);
+    assert_int_equal(ring->stride, 8);
+    assert_int_equal(ring->frames_written, 3);
+    assert_true(map_size >= ring->slot_offset + 2 * ring->slot_size);
+
+    for (uint32_t i = 0; i < 2; ++i) {
+        const uint8_t *slot = map + ring->slot_offset + i * ring->slot_size;
+        uint64_t frame_number;
+
+        memcpy(&frame_number, slot, sizeof(frame_number));
+        assert_int_equal(frame_number, i == 0 ? 3 : 2);
+        assert_memory_equal(slot + 64, frame_2x2 + 8, 8);
+        assert_memory_equal(slot + 72, frame_2x2 + 0, 8);
+    }
+
+    munmap((void*) map, map_size);
+    fclose(file);
+}
+
+static void
+test_wcore_capture_ring_rejects_y4m(void **state) {
+    FILE *file = tmpfile();
+    struct wcore_capture_options opts = default_options(fileno(file), 2, 2);
+
+    opts.sink = WAFFLE_CAPTURE_SINK_SHM_RING;
+    opts.format = WAFFLE_CAPTURE_FORMAT_Y4M;
+
+    wcore_error_reset();
+    assert_null(wcore_capture_create(&opts));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+
+    fclose(file);
+}
+
+static void
+test_wcore_capture_write_error(void **state) {
+    int fd = open("/dev/null", O_RDONLY);
+    struct wcore_capture_options opts = default_options(fd, 2, 2);
+    struct wcore_capture *capture;
+    struct waffle_capture_stats stats;
+
+    wcore_error_reset();
+    capture = wcore_capture_create(&opts);
+    assert_true(capture);
+
+    for (int i = 0; i < 8; ++i)
+        wcore_capture_push(capture, frame_2x2);
+
+    wcore_capture_get_stats(capture, &stats);
+    assert_int_equal(stats.frames_captured, 8);
+    assert_int_equal(stats.frames_written, 0);
+
+    assert_false(wcore_capture_destroy(capture));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_UNKNOWN);
+
+    close(fd);
+}
+
+int
+main(void) {
+    const UnitTest tests[] = {
+        unit_test(test_wcore_capture_raw_flips_rows),
+        unit_test(test_wcore_capture_y4m),
+        unit_test(test_wcore_capture_drop_when_full),
+        unit_test(test_wcore_capture_shm_ring),
+        unit_test(test_wcore_capture_ring_rejects_y4m),
+        unit_test(test_wcore_capture_write_error),
+    };
+
+    return run_tests(tests);
+}
@@ -59,6 +59,10 @@ check_keys(const int32_t attrib_list[])
             case WAFFLE_CONTEXT_PROFILE:
             case WAFFLE_CONTEXT_FORWARD_COMPATIBLE:
             case WAFFLE_CONTEXT_DEBUG:
+            case WAFFLE_CONTEXT_NO_ERROR:
+            case WAFFLE_CONTEXT_RELEASE_BEHAVIOR:
+            case WAFFLE_CONTEXT_PRIORITY:
+            case WAFFLE_CONTEXT_NO_CONFIG:
             case WAFFLE_RED_SIZE:
             case WAFFLE_GREEN_SIZE:
             case WAFFLE_BLUE_SIZE:
@@ -69,6 +73,9 @@ check_keys(const int32_t attrib_list[])
             case WAFFLE_SAMPLE_BUFFERS:
             case WAFFLE_DOUBLE_BUFFERED:
             case WAFFLE_ACCUM_BUFFER:
+            case WAFFLE_COLOR_FORMAT:
+            case WAFFLE_MUTABLE_RENDER_BUFFER:
+            case WAFFLE_CONFIG_SELECTION:
                 break;
             default:
                 wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
@@ -354,6 +361,8 @@ set_misc_defaults(struct wcore_config_attrs *attrs)
     // [2] EGL 1.4 spec (2011.04.06), Table 3.4
 
     attrs->context_debug        = false;
+    attrs->context_no_error     = false;
+    attrs->context_no_config    = false;
 
     attrs->rgba_size            = 0;
     attrs->red_size             = 0;
@@ -366,6 +375,83 @@ set_misc_defaults(struct wcore_config_attrs *attrs)
     attrs->samples              = 0;
     attrs->double_buffered      = true;
     attrs->accum_buffer         = false;
+    attrs->mutable_render_buffer = false;
+    attrs->color_format         = WAFFLE_DONT_CARE;
+    attrs->context_release_behavior = WAFFLE_DONT_CARE;
+    attrs->context_priority     = WAFFLE_DONT_CARE;
+    attrs->config_selection     = WAFFLE_DONT_CARE;
+
+    return true;
+}
+
+/// @brief Check a channel size requested alongside WAFFLE_COLOR_FORMAT.
+static bool
+check_color_format_size(int32_t attrib_name, int32_t *size, int32_t expect)
+{
+    if (*size != 0 && *size != WAFFLE_DONT_CARE && *size != expect) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "%s=%d conflicts with WAFFLE_COLOR_FORMAT, which "
+                     "requires %d", wcore_enum_to_string(attrib_name),
+                     *size, expect);
+        return false;
+    }
+
+    *size = expect;
+    return true;
+}
+
+/// @brief Set the channel sizes implied by WAFFLE_COLOR_FORMAT.
+static bool
+apply_color_format(struct wcore_config_attrs *attrs)
+{
+    int32_t red, green, blue, alpha;
+
+    switch (attrs->color_format) {
+        case WAFFLE_DONT_CARE:
+            return true;
+        case WAFFLE_COLOR_FORMAT_RGB565:
+            red = 5; green = 6; blue = 5; alpha = 0;
+            break;
+        case WAFFLE_COLOR_FORMAT_RGB10_A2:
+            red = 10; green = 10; blue = 10; alpha = 2;
+            break;
+        case WAFFLE_COLOR_FORMAT_RGBA16F:
+            red = 16; green = 16; blue = 16; alpha = 16;
+            break;
+        default:
+            wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                         "WAFFLE_COLOR_FORMAT has bad value 0x%x",
+                         attrs->color_format);
+            return false;
+    }
+
+    return check_color_format_size(WAFFLE_RED_SIZE, &attrs->red_size, red)
+        && check_color_format_size(WAFFLE_GREEN_SIZE, &attrs->green_size, green)
+        && check_color_format_size(WAFFLE_BLUE_SIZE, &attrs->blue_size, blue)
+        && check_color_format_size(WAFFLE_ALPHA_SIZE, &attrs->alpha_size, alpha);
+}
+
+/// @brief Check WAFFLE_CONTEXT_NO_ERROR against the other context attributes.
+///
+/// GL_KHR_no_error applies to OpenGL 2.0 and OpenGL ES 2.0 and later, and
+/// the EGL_KHR_create_context_no_error and GLX_ARB_create_context_no_error
+/// specs forbid combining it with a debug context.
+static bool
+check_context_no_error(const struct wcore_config_attrs *attrs)
+{
+    if (attrs->context_full_version < 20) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "To request a no-error context, the context version "
+                     "must be at least 2.0");
+        return false;
+    }
+
+    if (attrs->context_debug) {
+        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                     "WAFFLE_CONTEXT_NO_ERROR and WAFFLE_CONTEXT_DEBUG are "
+                     "mutually exclusive");
+        return false;
+    }
 
     return true;
 }
@@ -429,9 +515,62 @@ parse_misc(struct wcore_config_attrs *attrs,
             CASE_INT(WAFFLE_SAMPLES, samples)
 
             CASE_BOOL(WAFFLE_CONTEXT_DEBUG, context_debug, false);
+            CASE_BOOL(WAFFLE_CONTEXT_NO_ERROR, context_no_error, false);
+            CASE_BOOL(WAFFLE_CONTEXT_NO_CONFIG, context_no_config, false);
             CASE_BOOL(WAFFLE_SAMPLE_BUFFERS, sample_buffers, DEFAULT_SAMPLE_BUFFERS);
             CASE_BOOL(WAFFLE_DOUBLE_BUFFERED, double_buffered, DEFAULT_DOUBLE_BUFFERED);
             CASE_BOOL(WAFFLE_ACCUM_BUFFER, accum_buffer, DEFAULT_ACCUM_BUFFER);
+            CASE_BOOL(WAFFLE_MUTABLE_RENDER_BUFFER, mutable_render_buffer, false);
+
+            case WAFFLE_COLOR_FORMAT:
+                attrs->color_format = value;
+                break;
+
+            case WAFFLE_CONTEXT_RELEASE_BEHAVIOR:
+                switch (value) {
+                    case WAFFLE_DONT_CARE:
+                    case WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE:
+                    case WAFFLE_CONTEXT_RELEASE_BEHAVIOR_FLUSH:
+                        attrs->context_release_behavior = value;
+                        break;
+                    default:
+                        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                                     "WAFFLE_CONTEXT_RELEASE_BEHAVIOR has bad "
+                                     "value 0x%x", value);
+                        return false;
+                }
+                break;
+
+            case WAFFLE_CONTEXT_PRIORITY:
+                switch (value) {
+                    case WAFFLE_DONT_CARE:
+                    case WAFFLE_CONTEXT_PRIORITY_HIGH:
+                    case WAFFLE_CONTEXT_PRIORITY_MEDIUM:
+                    case WAFFLE_CONTEXT_PRIORITY_LOW:
+                        attrs->context_priority = value;
+                        break;
+                    default:
+                        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                                     "WAFFLE_CONTEXT_PRIORITY has bad value "
+                                     "0x%x", value);
+                        return false;
+                }
+                break;
+
+            case WAFFLE_CONFIG_SELECTION:
+                switch (value) {
+                    case WAFFLE_DONT_CARE:
+                    case WAFFLE_CONFIG_SELECTION_SPEC_ORDER:
+                    case WAFFLE_CONFIG_SELECTION_SMALLEST:
+                        attrs->config_selection = value;
+                        break;
+                    default:
+                        wcore_errorf(WAFFLE_ERROR_BAD_ATTRIBUTE,
+                                     "WAFFLE_CONFIG_SELECTION has bad value "
+                                     "0x%x", value);
+                        return false;
+                }
+                break;
 
             default:
                 wcore_error_internal("%s", "bad attribute key should have "
@@ -444,6 +583,12 @@ parse_misc(struct wcore_config_attrs *attrs,
         }
     }
 
+    if (attrs->context_no_error && !check_context_no_error(attrs))
+        return false;
+
+    if (!apply_color_format(attrs))
+        return false;
+
     // Calculate rgb_size.
     attrs->rgb_size = 0;
     if (attrs->red_size != WAFFLE_DONT_CARE)
@@ -57,11 +57,49 @@ struct wcore_config_attrs {
 
     int32_t samples;
 
+    /// @brief One of `WAFFLE_COLOR_FORMAT_*`, or WAFFLE_DONT_CARE.
+    ///
+    /// If set, the channel sizes above are those of the format, and the
+    /// platform must choose a config that matches them exactly.
+    int32_t color_format;
+
+    /// @brief One of `WAFFLE_CONTEXT_RELEASE_BEHAVIOR_*`, or
+    /// WAFFLE_DONT_CARE.
+    ///
+    /// WAFFLE_DONT_CARE leaves the native default, which flushes.
+    int32_t context_release_behavior;
+
+    /// @brief One of `WAFFLE_CONTEXT_PRIORITY_*`, or WAFFLE_DONT_CARE.
+    ///
+    /// A hint; the platform may grant a different priority.
+    int32_t context_priority;
+
+    /// @brief One of `WAFFLE_CONFIG_SELECTION_*`, or WAFFLE_DONT_CARE.
+    ///
+    /// WAFFLE_DONT_CARE takes the first config in the native sort order.
+    int32_t config_selection;
+
     bool context_forward_compatible;
     bool context_debug;
+
+    /// @brief Request a context that does not generate GL errors.
+    ///
+    /// Mutually exclusive with @a context_debug.
+    bool context_no_error;
+
+    /// @brief Create contexts without a native config, so that they can
+    /// render to windows of any config on the display.
+    ///
+    /// Windows cannot be created from such a config.
+    bool context_no_config;
+
     bool double_buffered;
     bool sample_buffers;
     bool accum_buffer;
+
+    /// @brief Allow waffle_window_set_render_buffer() on the config's
+    /// windows.
+    bool mutable_render_buffer;
 };
 
 bool
@@ -51,6 +51,8 @@ setup(void **state) {
         .context_full_version   = 10,
         .context_profile        = WAFFLE_NONE,
         .context_debug          = false,
+        .context_no_error       = false,
+        .context_no_config      = false,
         .context_forward_compatible = false,
 
         .rgb_size               = 0,
@@ -68,6 +70,12 @@ setup(void **state) {
         .samples                = 0,
 
         .double_buffered        = true,
+
+        .color_format           = WAFFLE_DONT_CARE,
+        .context_release_behavior = WAFFLE_DONT_CARE,
+        .context_priority       = WAFFLE_DONT_CARE,
+        .config_selection       = WAFFLE_DONT_CARE,
+        .mutable_render_buffer  = false,
     };
 
     struct test_state_wcore_config_attrs *ts;
@@ -606,6 +614,84 @@ test_wcore_config_attrs_color_buffer_size(void **state) {
     assert_memory_equal(&ts->actual_attrs, &ts->expect_attrs, sizeof(ts->expect_attrs));
 }
 
+static void
+test_wcore_config_attrs_color_format_rgb565(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_COLOR_FORMAT,    WAFFLE_COLOR_FORMAT_RGB565,
+        WAFFLE_GREEN_SIZE,      6, // agrees with the format
+        0,
+    };
+
+    ts->expect_attrs.color_format = WAFFLE_COLOR_FORMAT_RGB565;
+    ts->expect_attrs.red_size = 5;
+    ts->expect_attrs.green_size = 6;
+    ts->expect_attrs.blue_size = 5;
+    ts->expect_attrs.alpha_size = 0;
+
+    ts->expect_attrs.rgb_size = 5 + 6 + 5;
+    ts->expect_attrs.rgba_size = 5 + 6 + 5;
+
+    assert_true(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_memory_equal(&ts->actual_attrs, &ts->expect_attrs, sizeof(ts->expect_attrs));
+}
+
+static void
+test_wcore_config_attrs_color_format_rgba16f(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_COLOR_FORMAT,    WAFFLE_COLOR_FORMAT_RGBA16F,
+        0,
+    };
+
+    ts->expect_attrs.color_format = WAFFLE_COLOR_FORMAT_RGBA16F;
+    ts->expect_attrs.red_size = 16;
+    ts->expect_attrs.green_size = 16;
+    ts->expect_attrs.blue_size = 16;
+    ts->expect_attrs.alpha_size = 16;
+
+    ts->expect_attrs.rgb_size = 3 * 16;
+    ts->expect_attrs.rgba_size = 4 * 16;
+
+    assert_true(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_memory_equal(&ts->actual_attrs, &ts->expect_attrs, sizeof(ts->expect_attrs));
+}
+
+static void
+test_wcore_config_attrs_color_format_conflicting_size(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_COLOR_FORMAT,    WAFFLE_COLOR_FORMAT_RGB10_A2,
+        WAFFLE_ALPHA_SIZE,      8,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+    assert_true(strstr(wcore_error_get_info()->message, "WAFFLE_ALPHA_SIZE"));
+}
+
+static void
+test_wcore_config_attrs_color_format_is_bad(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_COLOR_FORMAT,    0x31415926,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+    assert_true(strstr(wcore_error_get_info()->message, "WAFFLE_COLOR_FORMAT"));
+}
+
 static void
 test_wcore_config_attrs_double_buffered_is_true(void **state) {
     struct test_state_wcore_config_attrs *ts = *state;
@@ -1164,6 +1250,232 @@ test_wcore_config_attrs_debug_gles3(void **state) {
     assert_memory_equal(&ts->actual_attrs, &ts->expect_attrs, sizeof(ts->expect_attrs));
 }
 
+static void
+test_wcore_config_attrs_no_error_gles2(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL_ES2,
+        WAFFLE_CONTEXT_NO_ERROR,                true,
+        0,
+    };
+
+    ts->expect_attrs.context_api = WAFFLE_CONTEXT_OPENGL_ES2;
+    ts->expect_attrs.context_full_version = 20;
+    ts->expect_attrs.context_major_version = 2;
+    ts->expect_attrs.context_no_error = true;
+
+    assert_true(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_NO_ERROR);
+    assert_memory_equal(&ts->actual_attrs, &ts->expect_attrs, sizeof(ts->expect_attrs));
+}
+
+static void
+test_wcore_config_attrs_no_error_is_bad(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONTEXT_NO_ERROR,                0x31415926,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+}
+
+static void
+test_wcore_config_attrs_no_error_gl10_emits_bad_attribute(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONTEXT_NO_ERROR,                true,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+}
+
+static void
+test_wcore_config_attrs_no_error_with_debug_emits_bad_attribute(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL_ES2,
+        WAFFLE_CONTEXT_DEBUG,                   true,
+        WAFFLE_CONTEXT_NO_ERROR,                true,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+}
+
+static void
+test_wcore_config_attrs_release_behavior_none(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONTEXT_RELEASE_BEHAVIOR,        WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE,
+        0,
+    };
+
+    ts->expect_attrs.context_release_behavior = WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE;
+
+    assert_true(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_NO_ERROR);
+    assert_memory_equal(&ts->actual_attrs, &ts->expect_attrs, sizeof(ts->expect_attrs));
+}
+
+static void
+test_wcore_config_attrs_release_behavior_is_bad(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONTEXT_RELEASE_BEHAVIOR,        true,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+    assert_true(strstr(wcore_error_get_info()->message, "WAFFLE_CONTEXT_RELEASE_BEHAVIOR"));
+}
+
+static void
+test_wcore_config_attrs_priority_high(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONTEXT_PRIORITY,                WAFFLE_CONTEXT_PRIORITY_HIGH,
+        0,
+    };
+
+    ts->expect_attrs.context_priority = WAFFLE_CONTEXT_PRIORITY_HIGH;
+
+    assert_true(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_NO_ERROR);
+    assert_memory_equal(&ts->actual_attrs, &ts->expect_attrs, sizeof(ts->expect_attrs));
+}
+
+static void
+test_wcore_config_attrs_priority_is_bad(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONTEXT_PRIORITY,                WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+    assert_true(strstr(wcore_error_get_info()->message, "WAFFLE_CONTEXT_PRIORITY"));
+}
+
+static void
+test_wcore_config_attrs_mutable_render_buffer(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_MUTABLE_RENDER_BUFFER,           true,
+        0,
+    };
+
+    ts->expect_attrs.mutable_render_buffer = true;
+
+    assert_true(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_NO_ERROR);
+    assert_memory_equal(&ts->actual_attrs, &ts->expect_attrs, sizeof(ts->expect_attrs));
+}
+
+static void
+test_wcore_config_attrs_mutable_render_buffer_is_bad(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_MUTABLE_RENDER_BUFFER,           2,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+    assert_true(strstr(wcore_error_get_info()->message, "WAFFLE_MUTABLE_RENDER_BUFFER"));
+}
+
+static void
+test_wcore_config_attrs_no_config(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL_ES2,
+        WAFFLE_CONTEXT_NO_CONFIG,               true,
+        0,
+    };
+
+    ts->expect_attrs.context_api = WAFFLE_CONTEXT_OPENGL_ES2;
+    ts->expect_attrs.context_major_version = 2;
+    ts->expect_attrs.context_full_version = 20;
+    ts->expect_attrs.context_no_config = true;
+
+    assert_true(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_NO_ERROR);
+    assert_memory_equal(&ts->actual_attrs, &ts->expect_attrs, sizeof(ts->expect_attrs));
+}
+
+static void
+test_wcore_config_attrs_no_config_is_bad(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONTEXT_NO_CONFIG,               2,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+    assert_true(strstr(wcore_error_get_info()->message, "WAFFLE_CONTEXT_NO_CONFIG"));
+}
+
+static void
+test_wcore_config_attrs_selection_smallest(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONFIG_SELECTION,                WAFFLE_CONFIG_SELECTION_SMALLEST,
+        0,
+    };
+
+    ts->expect_attrs.config_selection = WAFFLE_CONFIG_SELECTION_SMALLEST;
+
+    assert_true(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_NO_ERROR);
+    assert_memory_equal(&ts->actual_attrs, &ts->expect_attrs, sizeof(ts->expect_attrs));
+}
+
+static void
+test_wcore_config_attrs_selection_is_bad(void **state) {
+    struct test_state_wcore_config_attrs *ts = *state;
+
+    const int32_t attrib_list[] = {
+        WAFFLE_CONTEXT_API,                     WAFFLE_CONTEXT_OPENGL,
+        WAFFLE_CONFIG_SELECTION,                WAFFLE_CONTEXT_PRIORITY_LOW,
+        0,
+    };
+
+    assert_false(wcore_config_attrs_parse(attrib_list, &ts->actual_attrs));
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_BAD_ATTRIBUTE);
+    assert_true(strstr(wcore_error_get_info()->message, "WAFFLE_CONFIG_SELECTION"));
+}
+
 int
 main(void) {
     const UnitTest tests[] = {
@@ -1199,6 +1511,10 @@ main(void) {
         unit_test_make(test_wcore_config_attrs_gles3_with_version_20),
         unit_test_make(test_wcore_config_attrs_gles3_with_version_40),
         unit_test_make(test_wcore_config_attrs_color_buffer_size),
+        unit_test_make(test_wcore_config_attrs_color_format_rgb565),
+        unit_test_make(test_wcore_config_attrs_color_format_rgba16f),
+        unit_test_make(test_wcore_config_attrs_color_format_conflicting_size),
+        unit_test_make(test_wcore_config_attrs_color_format_is_bad),
         unit_test_make(test_wcore_config_attrs_double_buffered_is_true),
         unit_test_make(test_wcore_config_attrs_double_buffered_is_false),
         unit_test_make(test_wcore_config_attrs_double_buffered_is_bad),
@@ -1230,6 +1546,20 @@ main(void) {
         unit_test_make(test_wcore_config_attrs_debug_gles1),
         unit_test_make(test_wcore_config_attrs_debug_gles2),
         unit_test_make(test_wcore_config_attrs_debug_gles3),
+        unit_test_make(test_wcore_config_attrs_no_error_gles2),
+        unit_test_make(test_wcore_config_attrs_no_error_is_bad),
+        unit_test_make(test_wcore_config_attrs_no_error_gl10_emits_bad_attribute),
+        unit_test_make(test_wcore_config_attrs_no_error_with_debug_emits_bad_attribute),
+        unit_test_make(test_wcore_config_attrs_release_behavior_none),
+        unit_test_make(test_wcore_config_attrs_release_behavior_is_bad),
+        unit_test_make(test_wcore_config_attrs_priority_high),
+        unit_test_make(test_wcore_config_attrs_priority_is_bad),
+        unit_test_make(test_wcore_config_attrs_mutable_render_buffer),
+        unit_test_make(test_wcore_config_attrs_mutable_render_buffer_is_bad),
+        unit_test_make(test_wcore_config_attrs_no_config),
+        unit_test_make(test_wcore_config_attrs_no_config_is_bad),
+        unit_test_make(test_wcore_config_attrs_selection_smallest),
+        unit_test_make(test_wcore_config_attrs_selection_is_bad),
 
         #undef unit_test_make
     };
@@ -0,0 +1,111 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <assert.h>
+#include <string.h>
+
+#include "wcore_config_cache.h"
+
+void
+wcore_config_cache_init(struct wcore_config_cache *self)
+{
+    assert(self);
+
+    memset(self, 0, sizeof(*self));
+    pthread_mutex_init(&self->mutex, NULL);
+}
+
+void
+wcore_config_cache_teardown(struct wcore_config_cache *self)
+{
+    assert(self);
+
+    pthread_mutex_destroy(&self->mutex);
+    self->len = 0;
+}
+
+static struct wcore_config_cache_entry*
+find_entry(struct wcore_config_cache *self,
+           const struct wcore_config_attrs *attrs)
+{
+    for (int i = 0; i < self->len; ++i) {
+        struct wcore_config_cache_entry *entry = &self->entries[i];
+
+        if (memcmp(&entry->attrs, attrs, sizeof(*attrs)) == 0)
+            return entry;
+    }
+
+    return NULL;
+}
+
+bool
+wcore_config_cache_lookup(struct wcore_config_cache *self,
+                          const struct wcore_config_attrs *attrs,
+                          void *payload,
+                          size_t payload_size)
+{
+    struct wcore_config_cache_entry *entry;
+
+    assert(payload_size <= WCORE_CONFIG_CACHE_PAYLOAD_SIZE);
+
+    pthread_mutex_lock(&self->mutex);
+
+    entry = find_entry(self, attrs);
+    if (entry)
+        memcpy(payload, entry->payload.bytes, payload_size);
+
+    pthread_mutex_unlock(&self->mutex);
+
+    return entry != NULL;
+}
+
+void
+wcore_config_cache_insert(struct wcore_config_cache *self,
+                          const struct wcore_config_attrs *attrs,
+                          const void *payload,
+                          size_t payload_size)
+{
+    struct wcore_config_cache_entry *entry;
+
+    assert(payload_size <= WCORE_CONFIG_CACHE_PAYLOAD_SIZE);
+
+    pthread_mutex_lock(&self->mutex);
+
+    // Another thread may have inserted the same key since our lookup.
+    entry = find_entry(self, attrs);
+
+    if (!entry && self->len < WCORE_CONFIG_CACHE_LENGTH) {
+        entry = &self->entries[self->len++];
+    }
+    else if (!entry) {
+        entry = &self->entries[self->next_evict];
+        self->next_evict = (self->next_evict + 1) % WCORE_CONFIG_CACHE_LENGTH;
+    }
+
+    memcpy(&entry->attrs, attrs, sizeof(*attrs));
+    memcpy(entry->payload.bytes, payload, payload_size);
+
+    pthread_mutex_unlock(&self->mutex);
+}
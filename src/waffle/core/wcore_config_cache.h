@@ -0,0 +1,94 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "wcore_config_attrs.h"
+
+enum {
+    /// @brief Maximum number of configs cached per display.
+    WCORE_CONFIG_CACHE_LENGTH = 16,
+
+    /// @brief Maximum size of a platform's cached native config.
+    WCORE_CONFIG_CACHE_PAYLOAD_SIZE = 32,
+};
+
+struct wcore_config_cache_entry {
+    struct wcore_config_attrs attrs;
+
+    /// @brief The platform's resolved native config, copied by value.
+    union {
+        uint8_t bytes[WCORE_CONFIG_CACHE_PAYLOAD_SIZE];
+        void *align;
+    } payload;
+};
+
+/// @brief Map normalized config attributes to resolved native configs.
+///
+/// Each display owns one cache. Platforms consult it in config.choose before
+/// querying the driver, and add to it after a successful query, so that
+/// repeated calls to waffle_config_choose() with equal attribute lists do not
+/// reach the driver. The cache is destroyed with the display.
+///
+/// Keys are compared with memcmp, which relies on wcore_config_attrs_parse()
+/// zeroing the struct's padding.
+struct wcore_config_cache {
+    pthread_mutex_t mutex;
+    struct wcore_config_cache_entry entries[WCORE_CONFIG_CACHE_LENGTH];
+    int len;
+
+    /// @brief Entry to replace once the cache is full.
+    int next_evict;
+};
+
+void
+wcore_config_cache_init(struct wcore_config_cache *self);
+
+void
+wcore_config_cache_teardown(struct wcore_config_cache *self);
+
+/// @brief Find the payload cached for @a attrs.
+///
+/// @return true on a hit, in which case @a payload_size bytes are copied
+///     into @a payload.
+bool
+wcore_config_cache_lookup(struct wcore_config_cache *self,
+                          const struct wcore_config_attrs *attrs,
+                          void *payload,
+                          size_t payload_size);
+
+/// @brief Cache @a payload_size bytes of @a payload for @a attrs.
+///
+/// If the cache is full, the oldest entry is replaced.
+void
+wcore_config_cache_insert(struct wcore_config_cache *self,
+                          const struct wcore_config_attrs *attrs,
+                          const void *payload,
+                          size_t payload_size);
@@ -0,0 +1,167 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <cmocka.h>
+
+#include "waffle.h"
+
+#include "wcore_config_cache.h"
+
+struct test_state_wcore_config_cache {
+    struct wcore_config_cache cache;
+    struct wcore_config_attrs attrs;
+};
+
+static void
+setup(void **state) {
+    struct test_state_wcore_config_cache *ts;
+
+    ts = calloc(1, sizeof(*ts));
+    wcore_config_cache_init(&ts->cache);
+
+    ts->attrs.context_api = WAFFLE_CONTEXT_OPENGL;
+    ts->attrs.context_major_version = 1;
+    ts->attrs.context_full_version = 10;
+    ts->attrs.red_size = 8;
+
+    *state = ts;
+}
+
+static void
+teardown(void **state) {
+    struct test_state_wcore_config_cache *ts = *state;
+
+    wcore_config_cache_teardown(&ts->cache);
+    free(ts);
+}
+
+static void
+test_wcore_config_cache_empty_misses(void **state) {
+    struct test_state_wcore_config_cache *ts = *state;
+    intptr_t payload = 0;
+
+    assert_false(wcore_config_cache_lookup(&ts->cache, &ts->attrs,
+                                           &payload, sizeof(payload)));
+    assert_int_equal(payload, 0);
+}
+
+static void
+test_wcore_config_cache_insert_then_hit(void **state) {
+    struct test_state_wcore_config_cache *ts = *state;
+    intptr_t payload = 0x1234;
+
+    wcore_config_cache_insert(&ts->cache, &ts->attrs,
+                              &payload, sizeof(payload));
+
+    payload = 0;
+    assert_true(wcore_config_cache_lookup(&ts->cache, &ts->attrs,
+                                          &payload, sizeof(payload)));
+    assert_int_equal(payload, 0x1234);
+}
+
+static void
+test_wcore_config_cache_different_attrs_miss(void **state) {
+    struct test_state_wcore_config_cache *ts = *state;
+    struct wcore_config_attrs other = ts->attrs;
+    intptr_t payload = 0x1234;
+
+    wcore_config_cache_insert(&ts->cache, &ts->attrs,
+                              &payload, sizeof(payload));
+
+    other.depth_size = 24;
+    payload = 0;
+    assert_false(wcore_config_cache_lookup(&ts->cache, &other,
+                                           &payload, sizeof(payload)));
+    assert_int_equal(payload, 0);
+}
+
+static void
+test_wcore_config_cache_insert_replaces_equal_key(void **state) {
+    struct test_state_wcore_config_cache *ts = *state;
+    intptr_t payload = 1;
+
+    wcore_config_cache_insert(&ts->cache, &ts->attrs,
+                              &payload, sizeof(payload));
+    payload = 2;
+    wcore_config_cache_insert(&ts->cache, &ts->attrs,
+                              &payload, sizeof(payload));
+
+    assert_int_equal(ts->cache.len, 1);
+    assert_true(wcore_config_cache_lookup(&ts->cache, &ts->attrs,
+                                          &payload, sizeof(payload)));
+    assert_int_equal(payload, 2);
+}
+
+static void
+test_wcore_config_cache_evicts_oldest_when_full(void **state) {
+    struct test_state_wcore_config_cache *ts = *state;
+    struct wcore_config_attrs attrs = ts->attrs;
+    intptr_t payload;
+
+    for (int i = 0; i <= WCORE_CONFIG_CACHE_LENGTH; ++i) {
+        attrs.depth_size = i;
+        payload = i;
+        wcore_config_cache_insert(&ts->cache, &attrs,
+                                  &payload, sizeof(payload));
+    }
+
+    assert_int_equal(ts->cache.len, WCORE_CONFIG_CACHE_LENGTH);
+
+    // The first insertion was replaced by the last.
+    attrs.depth_size = 0;
+    assert_false(wcore_config_cache_lookup(&ts->cache, &attrs,
+                                           &payload, sizeof(payload)));
+
+    for (int i = 1; i <= WCORE_CONFIG_CACHE_LENGTH; ++i) {
+        attrs.depth_size = i;
+        assert_true(wcore_config_cache_lookup(&ts->cache, &attrs,
+                                              &payload, sizeof(payload)));
+        assert_int_equal(payload, i);
+    }
+}
+
+int
+main(void) {
+    const UnitTest tests[] = {
+        #define unit_test_make(name) unit_test_setup_teardown(name, setup, teardown)
+
+        unit_test_make(test_wcore_config_cache_empty_misses),
+        unit_test_make(test_wcore_config_cache_insert_then_hit),
+        unit_test_make(test_wcore_config_cache_different_attrs_miss),
+        unit_test_make(test_wcore_config_cache_insert_replaces_equal_key),
+        unit_test_make(test_wcore_config_cache_evicts_oldest_when_full),
+
+        #undef unit_test_make
+    };
+
+    return run_tests(tests);
+}
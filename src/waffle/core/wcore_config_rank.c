@@ -0,0 +1,87 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <assert.h>
+
+#include "wcore_config_rank.h"
+
+/// @brief Round @a bits up to the size of the texel that stores them.
+static int64_t
+storage_bits(int64_t bits)
+{
+    int64_t storage = 8;
+
+    if (bits <= 0)
+        return 0;
+
+    while (storage < bits)
+        storage *= 2;
+
+    return storage;
+}
+
+int64_t
+wcore_config_sizes_footprint(const struct wcore_config_sizes *sizes)
+{
+    int64_t color = (int64_t) sizes->red_size
+                  + sizes->green_size
+                  + sizes->blue_size
+                  + sizes->alpha_size;
+    int64_t depth_stencil = (int64_t) sizes->depth_size
+                          + sizes->stencil_size;
+    int64_t bits = storage_bits(color) + storage_bits(depth_stencil);
+
+    if (sizes->samples > 1)
+        bits *= sizes->samples;
+
+    return bits;
+}
+
+int
+wcore_config_rank_smallest(const struct wcore_config_sizes *candidates,
+                           int num_candidates)
+{
+    int best = 0;
+    int64_t best_footprint;
+
+    assert(num_candidates > 0);
+
+    best_footprint = wcore_config_sizes_footprint(&candidates[0]);
+
+    for (int i = 1; i < num_candidates; ++i) {
+        int64_t footprint = wcore_config_sizes_footprint(&candidates[i]);
+
+        if (candidates[i].caveat > candidates[best].caveat)
+            continue;
+
+        if (candidates[i].caveat < candidates[best].caveat ||
+            footprint < best_footprint) {
+            best = i;
+            best_footprint = footprint;
+        }
+    }
+
+    return best;
+}
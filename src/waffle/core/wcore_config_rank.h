@@ -0,0 +1,72 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <stdint.h>
+
+/// @brief The caveat of a native config, from most to least preferred.
+enum wcore_config_caveat {
+    WCORE_CONFIG_CAVEAT_NONE = 0,
+    WCORE_CONFIG_CAVEAT_SLOW,
+    WCORE_CONFIG_CAVEAT_NON_CONFORMANT,
+};
+
+/// @brief The buffer sizes of a native config, as queried from the driver.
+struct wcore_config_sizes {
+    /// @brief EGL_CONFIG_CAVEAT or GLX_CONFIG_CAVEAT.
+    enum wcore_config_caveat caveat;
+
+    int32_t red_size;
+    int32_t green_size;
+    int32_t blue_size;
+    int32_t alpha_size;
+
+    int32_t depth_size;
+    int32_t stencil_size;
+
+    /// @brief 0 for a single-sampled config.
+    int32_t samples;
+};
+
+/// @brief Return the number of bits that each pixel of a surface occupies.
+///
+/// Drivers store the color channels, and the depth and stencil channels, in
+/// texels of 8, 16, 32 or 64 bits, so each group is rounded up to a power
+/// of two. Every sample stores both groups.
+int64_t
+wcore_config_sizes_footprint(const struct wcore_config_sizes *sizes);
+
+/// @brief Return the index of the candidate with the smallest footprint.
+///
+/// The candidates must already meet the request, as those returned by
+/// eglChooseConfig() and glXChooseFBConfig() do. As in the native sort, a
+/// config with a lesser caveat always ranks first. Ties go to the earlier
+/// candidate, so the native sort order breaks them.
+///
+/// @param num_candidates must be positive.
+int
+wcore_config_rank_smallest(const struct wcore_config_sizes *candidates,
+                           int num_candidates);
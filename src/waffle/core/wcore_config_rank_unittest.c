@@ -0,0 +1,142 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cmocka.h>
+
+#include "wcore_config_rank.h"
+
+static const struct wcore_config_sizes rgba8888_d24s8 = {
+    .red_size = 8, .green_size = 8, .blue_size = 8, .alpha_size = 8,
+    .depth_size = 24, .stencil_size = 8,
+};
+
+static const struct wcore_config_sizes rgbx888 = {
+    .red_size = 8, .green_size = 8, .blue_size = 8,
+};
+
+static const struct wcore_config_sizes rgba8888 = {
+    .red_size = 8, .green_size = 8, .blue_size = 8, .alpha_size = 8,
+};
+
+static const struct wcore_config_sizes rgbx888_4x = {
+    .red_size = 8, .green_size = 8, .blue_size = 8,
+    .samples = 4,
+};
+
+static const struct wcore_config_sizes rgb565 = {
+    .red_size = 5, .green_size = 6, .blue_size = 5,
+};
+
+static const struct wcore_config_sizes rgb565_slow = {
+    .caveat = WCORE_CONFIG_CAVEAT_SLOW,
+    .red_size = 5, .green_size = 6, .blue_size = 5,
+};
+
+static const struct wcore_config_sizes rgb10_a2 = {
+    .red_size = 10, .green_size = 10, .blue_size = 10, .alpha_size = 2,
+};
+
+static const struct wcore_config_sizes rgba16f_d32s8 = {
+    .red_size = 16, .green_size = 16, .blue_size = 16, .alpha_size = 16,
+    .depth_size = 32, .stencil_size = 8,
+};
+
+static void
+test_wcore_config_sizes_footprint(void **state) {
+    // Channels are counted at the size of the texels that store them.
+    assert_int_equal(wcore_config_sizes_footprint(&rgba8888_d24s8), 64);
+    assert_int_equal(wcore_config_sizes_footprint(&rgbx888), 32);
+    assert_int_equal(wcore_config_sizes_footprint(&rgbx888_4x), 128);
+    assert_int_equal(wcore_config_sizes_footprint(&rgb565), 16);
+    assert_int_equal(wcore_config_sizes_footprint(&rgb10_a2), 32);
+    assert_int_equal(wcore_config_sizes_footprint(&rgba16f_d32s8), 128);
+}
+
+static void
+test_wcore_config_rank_smallest_prefers_fewer_bits(void **state) {
+    // The order in which eglChooseConfig sorts deeper color first.
+    const struct wcore_config_sizes candidates[] = {
+        rgba8888_d24s8,
+        rgbx888_4x,
+        rgba8888,
+        rgb565,
+    };
+
+    assert_int_equal(wcore_config_rank_smallest(candidates, 4), 3);
+}
+
+static void
+test_wcore_config_rank_smallest_counts_storage(void **state) {
+    // RGB888 is stored in 32 bits, as RGB10_A2 is.
+    const struct wcore_config_sizes candidates[] = {
+        rgb10_a2,
+        rgbx888,
+        rgba8888,
+    };
+
+    assert_int_equal(wcore_config_rank_smallest(candidates, 3), 0);
+}
+
+static void
+test_wcore_config_rank_smallest_ranks_caveat_first(void **state) {
+    const struct wcore_config_sizes candidates[] = {
+        rgb565_slow,
+        rgba8888_d24s8,
+        rgbx888,
+    };
+
+    assert_int_equal(wcore_config_rank_smallest(candidates, 3), 2);
+    assert_int_equal(wcore_config_rank_smallest(candidates, 1), 0);
+}
+
+static void
+test_wcore_config_rank_smallest_keeps_native_order_on_ties(void **state) {
+    const struct wcore_config_sizes candidates[] = {
+        rgba8888_d24s8,
+        rgbx888,
+        rgbx888,
+    };
+
+    assert_int_equal(wcore_config_rank_smallest(candidates, 3), 1);
+    assert_int_equal(wcore_config_rank_smallest(candidates, 1), 0);
+}
+
+int
+main(void) {
+    const UnitTest tests[] = {
+        unit_test(test_wcore_config_sizes_footprint),
+        unit_test(test_wcore_config_rank_smallest_prefers_fewer_bits),
+        unit_test(test_wcore_config_rank_smallest_counts_storage),
+        unit_test(test_wcore_config_rank_smallest_ranks_caveat_first),
+        unit_test(test_wcore_config_rank_smallest_keeps_native_order_on_ties),
+    };
+
+    return run_tests(tests);
+}
@@ -36,6 +36,7 @@
 
 struct wcore_context;
 struct wcore_display;
+struct waffle_gl_dispatch;
 union waffle_native_context;
 
 struct wcore_context {
@@ -43,6 +44,12 @@ struct wcore_context {
     struct api_object api;
 
     struct wcore_display *display;
+
+    /// @brief One of `WAFFLE_CONTEXT_OPENGL*`.
+    int32_t context_api;
+
+    /// @brief Created by waffle_context_get_gl_dispatch(). May be null.
+    struct waffle_gl_dispatch *gl_dispatch;
 };
 
 DEFINE_CONTAINER_CAST_FUNC(wcore_context,
@@ -59,6 +66,7 @@ wcore_context_init(struct wcore_context *self,
 
     self->api.display_id = config->display->api.display_id;
     self->display = config->display;
+    self->context_api = config->attrs.context_api;
 
     return true;
 }
@@ -67,5 +75,6 @@ static inline bool
 wcore_context_teardown(struct wcore_context *self)
 {
     assert(self);
+    free(self->gl_dispatch);
     return true;
 }
@@ -44,6 +44,7 @@ wcore_display_init(struct wcore_display *self,
     pthread_mutex_unlock(&mutex);
 
     self->platform = platform;
+    wcore_config_cache_init(&self->config_cache);
 
     if (self->api.display_id == 0) {
         fprintf(stderr, "waffle: error: internal counter wrapped to 0\n");
@@ -57,5 +58,6 @@ bool
 wcore_display_teardown(struct wcore_display *self)
 {
     assert(self);
+    wcore_config_cache_teardown(&self->config_cache);
     return true;
 }
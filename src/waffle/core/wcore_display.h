@@ -27,6 +27,7 @@
 
 #include "api_object.h"
 
+#include "wcore_config_cache.h"
 #include "wcore_util.h"
 
 struct wcore_display;
@@ -38,6 +39,9 @@ struct wcore_display {
     struct api_object api;
 
     struct wcore_platform *platform;
+
+    /// @brief Configs chosen on this display.
+    struct wcore_config_cache config_cache;
 };
 
 DEFINE_CONTAINER_CAST_FUNC(wcore_display,
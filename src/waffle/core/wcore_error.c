@@ -80,10 +80,14 @@ _wcore_error_enable(void)
     wcore_tinfo_get()->error->is_enabled = true;
 }
 
-void
+bool
 _wcore_error_disable(void)
 {
-    wcore_tinfo_get()->error->is_enabled = false;
+    struct wcore_error_tinfo *t = wcore_tinfo_get()->error;
+    bool was_enabled = t->is_enabled;
+
+    t->is_enabled = false;
+    return was_enabled;
 }
 
 void
@@ -79,11 +79,14 @@ wcore_error_errno(const char *format, ...);
     _wcore_error_internal(__FILE__, __LINE__, format, __VA_ARGS__)
 
 /// @brief Execute a statement with errors disabled.
+///
+/// Uses may nest. Errors stay disabled until the outermost use ends.
 #define WCORE_ERROR_DISABLED(statement) \
     do { \
-        _wcore_error_disable(); \
+        bool wcore_error_was_enabled__ = _wcore_error_disable(); \
         statement \
-        _wcore_error_enable(); \
+        if (wcore_error_was_enabled__) \
+            _wcore_error_enable(); \
     } while (0)
 
 /// @brief Get the last set error code.
@@ -98,6 +101,6 @@ void
 _wcore_error_internal(const char *file, int line, const char *format, ...);
 
 void _wcore_error_enable(void);
-void _wcore_error_disable(void);
+bool _wcore_error_disable(void);
 
 /// @}
@@ -126,6 +126,21 @@ test_wcore_error_disable_then_error_internal(void **state) {
     assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_NOT_INITIALIZED);
 }
 
+static void
+test_wcore_error_disable_nested(void **state) {
+    wcore_error_reset();
+    WCORE_ERROR_DISABLED({
+        WCORE_ERROR_DISABLED({
+            wcore_error(WAFFLE_ERROR_BAD_ATTRIBUTE);
+        });
+        wcore_error(WAFFLE_ERROR_BAD_PARAMETER);
+    });
+    assert_int_equal(wcore_error_get_code(), WAFFLE_NO_ERROR);
+
+    wcore_error(WAFFLE_ERROR_NOT_INITIALIZED);
+    assert_int_equal(wcore_error_get_code(), WAFFLE_ERROR_NOT_INITIALIZED);
+}
+
 /// Number of threads in test wcore_error.thread_local.
 enum {
     NUM_THREADS = 3,
@@ -242,6 +257,7 @@ main(void) {
         unit_test(test_wcore_error_disable_then_error),
         unit_test(test_wcore_error_disable_then_errorf),
         unit_test(test_wcore_error_disable_then_error_internal),
+        unit_test(test_wcore_error_disable_nested),
         unit_test(test_wcore_error_thread_local),
     };
 
@@ -33,8 +33,13 @@ struct wcore_config;
 struct wcore_config_attrs;
 struct wcore_context;
 struct wcore_display;
+struct wcore_fence;
 struct wcore_platform;
 struct wcore_window;
+struct waffle_device_info;
+struct waffle_dmabuf;
+struct waffle_symbol_cache_stats;
+struct waffle_window;
 
 struct wcore_platform_vtbl {
     bool
@@ -63,6 +68,31 @@ struct wcore_platform_vtbl {
             int32_t waffle_dl,
             const char *symbol);
 
+    /// May be null, in which case dl_sym is called for each symbol.
+    void
+    (*dl_sym_array)(
+            struct wcore_platform *self,
+            int32_t waffle_dl,
+            int32_t count,
+            const char *const symbols[],
+            void *syms[]);
+
+    /// May be null, if the platform does not cache symbols.
+    void
+    (*get_symbol_cache_stats)(
+            struct wcore_platform *self,
+            struct waffle_symbol_cache_stats *stats);
+
+    /// May be null.
+    int32_t
+    (*device_count)(struct wcore_platform *self);
+
+    /// May be null.
+    const struct waffle_device_info*
+    (*device_get_info)(
+            struct wcore_platform *self,
+            int32_t index);
+
     struct wcore_display_vtbl {
         struct wcore_display*
         (*connect)(struct wcore_platform *platform,
@@ -93,6 +123,15 @@ struct wcore_platform_vtbl {
         /// May be null.
         union waffle_native_config*
         (*get_native)(struct wcore_config *config);
+
+        /// @brief Query a buffer size of the chosen native config.
+        ///
+        /// @a attrib is a WAFFLE_*_SIZE, WAFFLE_SAMPLE_BUFFERS or
+        /// WAFFLE_SAMPLES. May be null.
+        bool
+        (*get_attrib)(struct wcore_config *config,
+                      int32_t attrib,
+                      int32_t *value);
     } config;
 
     struct wcore_context_vtbl {
@@ -107,6 +146,14 @@ struct wcore_platform_vtbl {
         /// May be null.
         union waffle_native_context*
         (*get_native)(struct wcore_context *ctx);
+
+        /// @brief Query the priority the platform granted, as one of
+        /// `WAFFLE_CONTEXT_PRIORITY_*`.
+        ///
+        /// May be null.
+        bool
+        (*get_priority)(struct wcore_context *ctx,
+                        int32_t *priority);
     } context;
 
     struct wcore_window_vtbl {
@@ -115,6 +162,19 @@ struct wcore_platform_vtbl {
                   struct wcore_config *config,
                   int width,
                   int height);
+
+        /// @brief Create a window whose buffers use one of @a modifiers.
+        ///
+        /// If @a num_modifiers is 0, the platform chooses among all the
+        /// modifiers it supports. May be null.
+        struct wcore_window*
+        (*create_with_modifiers)(struct wcore_platform *platform,
+                                 struct wcore_config *config,
+                                 int width,
+                                 int height,
+                                 const uint64_t *modifiers,
+                                 int32_t num_modifiers);
+
         bool
         (*destroy)(struct wcore_window *window);
 
@@ -129,10 +189,98 @@ struct wcore_platform_vtbl {
                   int32_t height,
                   int32_t width);
 
+        /// @brief Swap, telling the platform which rectangles changed.
+        ///
+        /// May be null, in which case the api layer calls swap_buffers.
+        bool
+        (*swap_buffers_with_damage)(struct wcore_window *window,
+                                    const int32_t *rects,
+                                    int32_t n_rects);
+
+        /// @brief Query the age of the back buffer. The window must be current.
+        ///
+        /// May be null.
+        bool
+        (*get_buffer_age)(struct wcore_window *window,
+                          int32_t *age);
+
+        /// @brief Limit rendering of the next frame to the given rectangles.
+        ///
+        /// May be null.
+        bool
+        (*set_damage_region)(struct wcore_window *window,
+                             const int32_t *rects,
+                             int32_t n_rects);
+
+        /// @brief Switch between back-buffered and single-buffered rendering
+        /// at the next swap.
+        ///
+        /// May be null.
+        bool
+        (*set_render_buffer)(struct wcore_window *window,
+                             int32_t buffer);
+
+        /// @brief Hand each posted buffer to @a func instead of recycling it.
+        ///
+        /// May be null.
+        bool
+        (*set_front_buffer_callback)(struct wcore_window *window,
+                                     void (*func)(struct waffle_window *window,
+                                                  void *buffer,
+                                                  void *user_data),
+                                     void *user_data);
+
+        /// @brief Return a buffer given to the front buffer callback.
+        ///
+        /// May be null.
+        bool
+        (*release_front_buffer)(struct wcore_window *window,
+                                void *buffer);
+
+        /// @brief Export the buffer posted by the last swap as a dma-buf.
+        ///
+        /// May be null.
+        bool
+        (*export_dmabuf)(struct wcore_window *window,
+                         struct waffle_dmabuf *dmabuf);
+
+        /// May be null.
+        bool
+        (*set_swap_interval)(struct wcore_window *window,
+                             int32_t interval);
+
         /// May be null.
         union waffle_native_window*
         (*get_native)(struct wcore_window *window);
     } window;
+
+    struct wcore_fence_vtbl {
+        /// @brief Insert a fence into the command stream of @a ctx.
+        ///
+        /// The context is current. The fence must be flushed, so that a
+        /// wait from another thread terminates. May be null, in which case
+        /// the other members are ignored.
+        struct wcore_fence*
+        (*create)(struct wcore_platform *platform,
+                  struct wcore_context *ctx);
+
+        bool
+        (*destroy)(struct wcore_fence *fence);
+
+        /// @brief Wait up to @a timeout_ns for the fence to signal.
+        ///
+        /// A timeout is not an error; @a signaled is then false.
+        bool
+        (*wait)(struct wcore_fence *fence,
+                uint64_t timeout_ns,
+                bool *signaled);
+
+        /// @brief Return a new sync file descriptor for the fence, or -1.
+        ///
+        /// May be null.
+        int
+        (*export_fd)(struct wcore_fence *fence);
+    } fence;
 };
 
 struct wcore_platform {
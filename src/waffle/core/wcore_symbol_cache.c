@@ -0,0 +1,241 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define _POSIX_C_SOURCE 200809L // glibc feature macro for strdup()
+
+/// @addtogroup wcore_symbol_cache
+/// @{
+
+/// @file
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "wcore_symbol_cache.h"
+
+enum {
+    /// @brief Number of slots allocated by the first insertion.
+    WCORE_SYMBOL_CACHE_INITIAL_CAPACITY = 256,
+};
+
+/// @brief FNV-1a, with @a key folded into the seed.
+static uint32_t
+hash_symbol(int32_t key, const char *name)
+{
+    uint32_t h = 2166136261u ^ (uint32_t) key;
+
+    for (const char *c = name; *c; ++c) {
+        h ^= (uint8_t) *c;
+        h *= 16777619u;
+    }
+
+    return h;
+}
+
+/// @brief Return the slot holding (key, name), or the empty slot where it
+/// belongs.
+static struct wcore_symbol_cache_entry*
+find_slot(struct wcore_symbol_cache_entry *entries,
+          size_t capacity,
+          uint32_t hash,
+          int32_t key,
+          const char *name)
+{
+    const size_t mask = capacity - 1;
+
+    for (size_t i = hash & mask; ; i = (i + 1) & mask) {
+        struct wcore_symbol_cache_entry *entry = &entries[i];
+
+        if (!entry->name)
+            return entry;
+
+        if (entry->hash == hash &&
+            entry->key == key &&
+            strcmp(entry->name, name) == 0)
+            return entry;
+    }
+}
+
+static bool
+grow(struct wcore_symbol_cache *self)
+{
+    size_t new_capacity = self->capacity
+                        ? 2 * self->capacity
+                        : WCORE_SYMBOL_CACHE_INITIAL_CAPACITY;
+    struct wcore_symbol_cache_entry *new_entries;
+
+    new_entries = calloc(new_capacity, sizeof(*new_entries));
+    if (!new_entries)
+        return false;
+
+    for (size_t i = 0; i < self->capacity; ++i) {
+        struct wcore_symbol_cache_entry *old = &self->entries[i];
+
+        if (!old->name)
+            continue;
+
+        *find_slot(new_entries, new_capacity,
+                   old->hash, old->key, old->name) = *old;
+    }
+
+    free(self->entries);
+    self->entries = new_entries;
+    self->capacity = new_capacity;
+    return true;
+}
+
+void
+wcore_symbol_cache_init(struct wcore_symbol_cache *self)
+{
+    assert(self);
+
+    memset(self, 0, sizeof(*self));
+    pthread_mutex_init(&self->mutex, NULL);
+}
+
+void
+wcore_symbol_cache_teardown(struct wcore_symbol_cache *self)
+{
+    assert(self);
+
+    for (size_t i = 0; i < self->capacity; ++i)
+        free(self->entries[i].name);
+
+    free(self->entries);
+    self->entries = NULL;
+    self->capacity = 0;
+    self->len = 0;
+
+    pthread_mutex_destroy(&self->mutex);
+}
+
+void*
+wcore_symbol_cache_lookup(struct wcore_symbol_cache *self,
+                          int32_t key,
+                          const char *name)
+{
+    uint32_t hash = hash_symbol(key, name);
+    void *address = NULL;
+
+    pthread_mutex_lock(&self->mutex);
+
+    if (self->len > 0) {
+        address = find_slot(self->entries, self->capacity,
+                            hash, key, name)->address;
+    }
+
+    if (address)
+        ++self->hits;
+    else
+        ++self->misses;
+
+    pthread_mutex_unlock(&self->mutex);
+
+    return address;
+}
+
+int32_t
+wcore_symbol_cache_lookup_array(struct wcore_symbol_cache *self,
+                                int32_t key,
+                                int32_t count,
+                                const char *const names[],
+                                void *addresses[])
+{
+    int32_t num_misses = 0;
+
+    pthread_mutex_lock(&self->mutex);
+
+    for (int32_t i = 0; i < count; ++i) {
+        addresses[i] = NULL;
+
+        if (self->len > 0) {
+            addresses[i] = find_slot(self->entries, self->capacity,
+                                     hash_symbol(key, names[i]),
+                                     key, names[i])->address;
+        }
+
+        if (!addresses[i])
+            ++num_misses;
+    }
+
+    self->hits += count - num_misses;
+    self->misses += num_misses;
+
+    pthread_mutex_unlock(&self->mutex);
+
+    return num_misses;
+}
+
+void
+wcore_symbol_cache_insert(struct wcore_symbol_cache *self,
+                          int32_t key,
+                          const char *name,
+                          void *address)
+{
+    uint32_t hash = hash_symbol(key, name);
+    struct wcore_symbol_cache_entry *entry;
+
+    if (!address)
+        return;
+
+    pthread_mutex_lock(&self->mutex);
+
+    // Keep the load factor at or below 3/4 so that probes stay short.
+    if (4 * (self->len + 1) > 3 * self->capacity && !grow(self))
+        goto unlock;
+
+    entry = find_slot(self->entries, self->capacity, hash, key, name);
+    if (!entry->name) {
+        entry->name = strdup(name);
+        if (!entry->name)
+            goto unlock;
+
+        entry->hash = hash;
+        entry->key = key;
+        ++self->len;
+    }
+
+    entry->address = address;
+
+unlock:
+    pthread_mutex_unlock(&self->mutex);
+}
+
+void
+wcore_symbol_cache_get_stats(struct wcore_symbol_cache *self,
+                             struct waffle_symbol_cache_stats *stats)
+{
+    assert(self);
+    assert(stats);
+
+    pthread_mutex_lock(&self->mutex);
+    stats->hits = self->hits;
+    stats->misses = self->misses;
+    stats->num_symbols = self->len;
+    pthread_mutex_unlock(&self->mutex);
+}
+
+/// @}
@@ -0,0 +1,113 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/// @defgroup wcore_symbol_cache wcore_symbol_cache
+/// @ingroup wcore
+///
+/// @brief Cache of resolved symbol addresses.
+///
+/// An open-addressing hash table, with linear probing, that maps a
+/// (key, name) pair to an address. The key distinguishes namespaces, such as
+/// the `WAFFLE_DL_*` libraries. The table is guarded by a mutex, because
+/// waffle_dl_sym() and waffle_get_proc_address() may be called from any
+/// thread.
+/// @{
+
+/// @file
+
+#pragma once
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "waffle.h"
+
+struct wcore_symbol_cache_entry {
+    /// @brief Owned copy of the symbol name. Null if the slot is empty.
+    char *name;
+    uint32_t hash;
+    int32_t key;
+    void *address;
+};
+
+struct wcore_symbol_cache {
+    pthread_mutex_t mutex;
+
+    /// @brief Array of @a capacity slots. Capacity is a power of two.
+    struct wcore_symbol_cache_entry *entries;
+    size_t capacity;
+    size_t len;
+
+    uint64_t hits;
+    uint64_t misses;
+};
+
+void
+wcore_symbol_cache_init(struct wcore_symbol_cache *self);
+
+void
+wcore_symbol_cache_teardown(struct wcore_symbol_cache *self);
+
+/// @brief Find the address cached for @a name in namespace @a key.
+///
+/// Count a hit or a miss.
+///
+/// @return null on a miss.
+void*
+wcore_symbol_cache_lookup(struct wcore_symbol_cache *self,
+                          int32_t key,
+                          const char *name);
+
+/// @brief Look up @a count names in namespace @a key, taking the lock once.
+///
+/// Store each address in the corresponding element of @a addresses, or null
+/// on a miss.
+///
+/// @return the number of misses.
+int32_t
+wcore_symbol_cache_lookup_array(struct wcore_symbol_cache *self,
+                                int32_t key,
+                                int32_t count,
+                                const char *const names[],
+                                void *addresses[]);
+
+/// @brief Cache @a address for @a name in namespace @a key.
+///
+/// A null @a address is not cached. If memory runs out, the symbol is
+/// silently left uncached.
+void
+wcore_symbol_cache_insert(struct wcore_symbol_cache *self,
+                          int32_t key,
+                          const char *name,
+                          void *address);
+
+/// @brief Copy the counters under the lock.
+void
+wcore_symbol_cache_get_stats(struct wcore_symbol_cache *self,
+                             struct waffle_symbol_cache_stats *stats);
+
+/// @}
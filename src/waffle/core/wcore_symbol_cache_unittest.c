@@ -0,0 +1,182 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <cmocka.h>
+
+#include "wcore_symbol_cache.h"
+
+static void
+setup(void **state) {
+    struct wcore_symbol_cache *cache;
+
+    cache = calloc(1, sizeof(*cache));
+    wcore_symbol_cache_init(cache);
+    *state = cache;
+}
+
+static void
+teardown(void **state) {
+    struct wcore_symbol_cache *cache = *state;
+
+    wcore_symbol_cache_teardown(cache);
+    free(cache);
+}
+
+static void
+test_wcore_symbol_cache_empty_misses(void **state) {
+    struct wcore_symbol_cache *cache = *state;
+
+    assert_true(wcore_symbol_cache_lookup(cache, 1, "glClear") == NULL);
+    assert_int_equal(cache->hits, 0);
+    assert_int_equal(cache->misses, 1);
+}
+
+static void
+test_wcore_symbol_cache_insert_then_hit(void **state) {
+    struct wcore_symbol_cache *cache = *state;
+    int sym;
+
+    wcore_symbol_cache_insert(cache, 1, "glClear", &sym);
+
+    assert_true(wcore_symbol_cache_lookup(cache, 1, "glClear") == &sym);
+    assert_int_equal(cache->hits, 1);
+    assert_int_equal(cache->misses, 0);
+    assert_int_equal(cache->len, 1);
+}
+
+static void
+test_wcore_symbol_cache_keys_are_separate(void **state) {
+    struct wcore_symbol_cache *cache = *state;
+    int sym1, sym2;
+
+    wcore_symbol_cache_insert(cache, 1, "glClear", &sym1);
+    wcore_symbol_cache_insert(cache, 2, "glClear", &sym2);
+
+    assert_true(wcore_symbol_cache_lookup(cache, 1, "glClear") == &sym1);
+    assert_true(wcore_symbol_cache_lookup(cache, 2, "glClear") == &sym2);
+    assert_true(wcore_symbol_cache_lookup(cache, 3, "glClear") == NULL);
+    assert_true(wcore_symbol_cache_lookup(cache, 1, "glClea") == NULL);
+}
+
+static void
+test_wcore_symbol_cache_null_is_not_cached(void **state) {
+    struct wcore_symbol_cache *cache = *state;
+
+    wcore_symbol_cache_insert(cache, 1, "glBogus", NULL);
+
+    assert_int_equal(cache->len, 0);
+    assert_true(wcore_symbol_cache_lookup(cache, 1, "glBogus") == NULL);
+}
+
+static void
+test_wcore_symbol_cache_lookup_array(void **state) {
+    struct wcore_symbol_cache *cache = *state;
+    const char *const names[] = {"glClear", "glBogus", "glFlush"};
+    int sentinel;
+    void *addresses[3] = {NULL, &sentinel, NULL};
+    int sym1, sym2;
+
+    wcore_symbol_cache_insert(cache, 1, "glClear", &sym1);
+    wcore_symbol_cache_insert(cache, 1, "glFlush", &sym2);
+
+    assert_int_equal(wcore_symbol_cache_lookup_array(cache, 1, 3, names,
+                                                     addresses), 1);
+    assert_true(addresses[0] == &sym1);
+    assert_true(addresses[1] == NULL);
+    assert_true(addresses[2] == &sym2);
+    assert_int_equal(cache->hits, 2);
+    assert_int_equal(cache->misses, 1);
+}
+
+static void
+test_wcore_symbol_cache_grows(void **state) {
+    struct wcore_symbol_cache *cache = *state;
+    static char syms[2000];
+    char name[32];
+
+    for (int i = 0; i < 2000; ++i) {
+        snprintf(name, sizeof(name), "glFunc%d", i);
+        wcore_symbol_cache_insert(cache, 1, name, &syms[i]);
+    }
+
+    assert_int_equal(cache->len, 2000);
+    assert_true(4 * cache->len <= 3 * cache->capacity);
+
+    for (int i = 0; i < 2000; ++i) {
+        snprintf(name, sizeof(name), "glFunc%d", i);
+        assert_true(wcore_symbol_cache_lookup(cache, 1, name) == &syms[i]);
+    }
+
+    assert_int_equal(cache->hits, 2000);
+    assert_int_equal(cache->misses, 0);
+}
+
+static void
+test_wcore_symbol_cache_get_stats(void **state) {
+    struct wcore_symbol_cache *cache = *state;
+    struct waffle_symbol_cache_stats stats;
+    int sym;
+
+    wcore_symbol_cache_get_stats(cache, &stats);
+    assert_int_equal(stats.hits, 0);
+    assert_int_equal(stats.misses, 0);
+    assert_int_equal(stats.num_symbols, 0);
+
+    assert_true(wcore_symbol_cache_lookup(cache, 1, "glClear") == NULL);
+    wcore_symbol_cache_insert(cache, 1, "glClear", &sym);
+    wcore_symbol_cache_insert(cache, 1, "glBogus", NULL);
+    assert_true(wcore_symbol_cache_lookup(cache, 1, "glClear") == &sym);
+    assert_true(wcore_symbol_cache_lookup(cache, 1, "glClear") == &sym);
+
+    wcore_symbol_cache_get_stats(cache, &stats);
+    assert_int_equal(stats.hits, 2);
+    assert_int_equal(stats.misses, 1);
+    assert_int_equal(stats.num_symbols, 1);
+}
+
+int
+main(void) {
+    const UnitTest tests[] = {
+        #define unit_test_make(name) unit_test_setup_teardown(name, setup, teardown)
+
+        unit_test_make(test_wcore_symbol_cache_empty_misses),
+        unit_test_make(test_wcore_symbol_cache_insert_then_hit),
+        unit_test_make(test_wcore_symbol_cache_keys_are_separate),
+        unit_test_make(test_wcore_symbol_cache_null_is_not_cached),
+        unit_test_make(test_wcore_symbol_cache_lookup_array),
+        unit_test_make(test_wcore_symbol_cache_grows),
+        unit_test_make(test_wcore_symbol_cache_get_stats),
+
+        #undef unit_test_make
+    };
+
+    return run_tests(tests);
+}
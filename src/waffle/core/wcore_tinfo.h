@@ -33,13 +33,29 @@
 
 #pragma once
 
+#include <stdbool.h>
+
+struct wcore_context;
+struct wcore_display;
 struct wcore_error_tinfo;
+struct wcore_window;
 
 /// @brief Thread-local info for all of Waffle.
 struct wcore_tinfo {
     /// @brief Info for @ref wcore_error.
     struct wcore_error_tinfo *error;
 
+    /// @brief The objects last made current on this thread by
+    /// waffle_make_current().
+    ///
+    /// All are null if no context is current. Bindings made by calling the
+    /// native API directly are not tracked.
+    struct {
+        struct wcore_display *display;
+        struct wcore_window *window;
+        struct wcore_context *context;
+    } current;
+
     bool is_init;
 };
 
@@ -60,6 +60,8 @@ wcore_enum_to_string(int32_t e)
         CASE(WAFFLE_PLATFORM_GLX);
         CASE(WAFFLE_PLATFORM_WAYLAND);
         CASE(WAFFLE_PLATFORM_X11_EGL);
+        CASE(WAFFLE_PLATFORM_SURFACELESS_EGL);
+        CASE(WAFFLE_PLATFORM_DEVICE_EGL);
         CASE(WAFFLE_CONTEXT_API);
         CASE(WAFFLE_CONTEXT_OPENGL);
         CASE(WAFFLE_CONTEXT_OPENGL_ES1);
@@ -72,6 +74,15 @@ wcore_enum_to_string(int32_t e)
         CASE(WAFFLE_CONTEXT_COMPATIBILITY_PROFILE);
         CASE(WAFFLE_CONTEXT_FORWARD_COMPATIBLE);
         CASE(WAFFLE_CONTEXT_DEBUG);
+        CASE(WAFFLE_CONTEXT_NO_ERROR);
+        CASE(WAFFLE_CONTEXT_RELEASE_BEHAVIOR);
+        CASE(WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE);
+        CASE(WAFFLE_CONTEXT_RELEASE_BEHAVIOR_FLUSH);
+        CASE(WAFFLE_CONTEXT_PRIORITY);
+        CASE(WAFFLE_CONTEXT_PRIORITY_HIGH);
+        CASE(WAFFLE_CONTEXT_PRIORITY_MEDIUM);
+        CASE(WAFFLE_CONTEXT_PRIORITY_LOW);
+        CASE(WAFFLE_CONTEXT_NO_CONFIG);
         CASE(WAFFLE_RED_SIZE);
         CASE(WAFFLE_GREEN_SIZE);
         CASE(WAFFLE_BLUE_SIZE);
@@ -82,9 +93,32 @@ wcore_enum_to_string(int32_t e)
         CASE(WAFFLE_SAMPLES);
         CASE(WAFFLE_DOUBLE_BUFFERED);
         CASE(WAFFLE_ACCUM_BUFFER);
+        CASE(WAFFLE_COLOR_FORMAT);
+        CASE(WAFFLE_COLOR_FORMAT_RGB565);
+        CASE(WAFFLE_COLOR_FORMAT_RGB10_A2);
+        CASE(WAFFLE_COLOR_FORMAT_RGBA16F);
+        CASE(WAFFLE_MUTABLE_RENDER_BUFFER);
+        CASE(WAFFLE_CONFIG_SELECTION);
+        CASE(WAFFLE_CONFIG_SELECTION_SPEC_ORDER);
+        CASE(WAFFLE_CONFIG_SELECTION_SMALLEST);
         CASE(WAFFLE_DL_OPENGL);
         CASE(WAFFLE_DL_OPENGL_ES1);
         CASE(WAFFLE_DL_OPENGL_ES2);
+        CASE(WAFFLE_CAPTURE_FD);
+        CASE(WAFFLE_CAPTURE_SINK);
+        CASE(WAFFLE_CAPTURE_SINK_STREAM);
+        CASE(WAFFLE_CAPTURE_SINK_SHM_RING);
+        CASE(WAFFLE_CAPTURE_FORMAT);
+        CASE(WAFFLE_CAPTURE_FORMAT_RAW);
+        CASE(WAFFLE_CAPTURE_FORMAT_Y4M);
+        CASE(WAFFLE_CAPTURE_POLICY);
+        CASE(WAFFLE_CAPTURE_POLICY_BLOCK);
+        CASE(WAFFLE_CAPTURE_POLICY_DROP);
+        CASE(WAFFLE_CAPTURE_QUEUE_DEPTH);
+        CASE(WAFFLE_CAPTURE_RING_SLOTS);
+        CASE(WAFFLE_CAPTURE_FRAME_RATE);
+        CASE(WAFFLE_RENDER_BUFFER_BACK);
+        CASE(WAFFLE_RENDER_BUFFER_SINGLE);
 
         default: return NULL;
 
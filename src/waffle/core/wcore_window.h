@@ -36,6 +36,15 @@ struct wcore_window {
     struct api_object api;
 
     struct wcore_display *display;
+
+    /// @brief The size requested at creation or by the last resize.
+    int32_t width;
+    int32_t height;
+
+    /// @brief The capture attached with waffle_window_attach_capture().
+    ///
+    /// May be null.
+    struct waffle_capture *capture;
 };
 
 DEFINE_CONTAINER_CAST_FUNC(wcore_window,
@@ -0,0 +1,103 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdlib.h>
+
+#include "wcore_error.h"
+
+#include "degl_display.h"
+#include "degl_platform.h"
+
+bool
+degl_display_destroy(struct wcore_display *wc_self)
+{
+    struct degl_display *self = degl_display(wc_self);
+    bool ok = true;
+
+    if (!self)
+        return ok;
+
+    ok &= wegl_display_teardown(&self->wegl);
+    free(self);
+    return ok;
+}
+
+struct wcore_display*
+degl_display_connect(struct wcore_platform *wc_plat,
+                     const char *name)
+{
+    struct degl_platform *plat = degl_platform(wc_plat);
+    struct degl_display *self;
+    int32_t index;
+    bool ok = true;
+
+    self = wcore_calloc(sizeof(*self));
+    if (self == NULL)
+        return NULL;
+
+    index = degl_platform_find_device(plat, name);
+    if (index < 0)
+        goto error;
+
+    self->egl_device = plat->devices[index];
+
+    ok = wegl_display_init_platform(&self->wegl, wc_plat,
+                                    EGL_PLATFORM_DEVICE_EXT,
+                                    self->egl_device);
+    if (!ok)
+        goto error;
+
+    // There are no native windows. Every waffle_window is a pbuffer.
+    self->wegl.egl_surface_type = EGL_PBUFFER_BIT;
+
+    return &self->wegl.wcore;
+
+error:
+    degl_display_destroy(&self->wegl.wcore);
+    return NULL;
+}
+
+void
+degl_display_fill_native(struct degl_display *self,
+                         struct waffle_device_egl_display *n_dpy)
+{
+    n_dpy->egl_device = self->egl_device;
+    n_dpy->egl_display = self->wegl.egl;
+}
+
+union waffle_native_display*
+degl_display_get_native(struct wcore_display *wc_self)
+{
+    struct degl_display *self = degl_display(wc_self);
+    union waffle_native_display *n_dpy;
+
+    WCORE_CREATE_NATIVE_UNION(n_dpy, device_egl);
+    if (n_dpy == NULL)
+        return NULL;
+
+    degl_display_fill_native(self, n_dpy->device_egl);
+
+    return n_dpy;
+}
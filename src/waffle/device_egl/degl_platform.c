@@ -0,0 +1,377 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "wcore_error.h"
+
+#include "linux_platform.h"
+
+#include "wegl_config.h"
+#include "wegl_context.h"
+#include "wegl_fence.h"
+#include "wegl_imports.h"
+#include "wegl_util.h"
+#include "wegl_window.h"
+
+#include "degl_display.h"
+#include "degl_platform.h"
+#include "degl_window.h"
+
+static const struct wcore_platform_vtbl degl_platform_vtbl;
+
+static bool
+degl_platform_destroy(struct wcore_platform *wc_self)
+{
+    struct degl_platform *self = degl_platform(wc_self);
+    bool ok = true;
+
+    if (!self)
+        return true;
+
+    if (self->linux)
+        ok &= linux_platform_destroy(self->linux);
+
+    free(self->devices);
+    free(self->device_infos);
+
+    ok &= wcore_platform_teardown(wc_self);
+    free(self);
+    return ok;
+}
+
+/// @brief Return the device string, or null if the device lacks @a extension.
+static const char*
+query_device_string(PFNEGLQUERYDEVICESTRINGEXTPROC query_device_string,
+                    EGLDeviceEXT device,
+                    const char *device_extensions,
+                    const char *extension,
+                    EGLint name)
+{
+    if (!device_extensions ||
+        !waffle_is_extension_in_string(device_extensions, extension))
+        return NULL;
+
+    return query_device_string(device, name);
+}
+
+/// @brief Query every EGL device and fill the platform's device tables.
+static bool
+degl_platform_enumerate_devices(struct degl_platform *self)
+{
+    PFNEGLQUERYDEVICESEXTPROC query_devices;
+    PFNEGLQUERYDEVICESTRINGEXTPROC query_device_string_ext;
+    const char *client_extensions;
+    EGLint num_devices = 0;
+    bool ok;
+
+    client_extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if (!client_extensions ||
+        !waffle_is_extension_in_string(client_extensions,
+                                       "EGL_EXT_device_enumeration") ||
+        !waffle_is_extension_in_string(client_extensions,
+                                       "EGL_EXT_platform_device")) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_EXT_device_enumeration and EGL_EXT_platform_device "
+                     "are required");
+        return false;
+    }
+
+    query_devices = (PFNEGLQUERYDEVICESEXTPROC)
+        eglGetProcAddress("eglQueryDevicesEXT");
+    query_device_string_ext = (PFNEGLQUERYDEVICESTRINGEXTPROC)
+        eglGetProcAddress("eglQueryDeviceStringEXT");
+    if (!query_devices || !query_device_string_ext) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "failed to get EGL_EXT_device_enumeration functions");
+        return false;
+    }
+
+    ok = query_devices(0, NULL, &num_devices);
+    if (!ok) {
+        wegl_emit_error("eglQueryDevicesEXT");
+        return false;
+    }
+
+    if (num_devices == 0) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "eglQueryDevicesEXT found no devices");
+        return false;
+    }
+
+    self->devices = wcore_calloc(num_devices * sizeof(*self->devices));
+    self->device_infos = wcore_calloc(num_devices * sizeof(*self->device_infos));
+    if (!self->devices || !self->device_infos)
+        return false;
+
+    ok = query_devices(num_devices, self->devices, &num_devices);
+    if (!ok) {
+        wegl_emit_error("eglQueryDevicesEXT");
+        return false;
+    }
+
+    for (EGLint i = 0; i < num_devices; ++i) {
+        struct waffle_device_info *info = &self->device_infos[i];
+        EGLDeviceEXT dev = self->devices[i];
+
+        info->index = i;
+        info->extensions = query_device_string_ext(dev, EGL_EXTENSIONS);
+        info->drm_device_file =
+            query_device_string(query_device_string_ext, dev, info->extensions,
+                                "EGL_EXT_device_drm",
+                                EGL_DRM_DEVICE_FILE_EXT);
+        info->drm_render_node_file =
+            query_device_string(query_device_string_ext, dev, info->extensions,
+                                "EGL_EXT_device_drm_render_node",
+                                EGL_DRM_RENDER_NODE_FILE_EXT);
+        info->driver_name =
+            query_device_string(query_device_string_ext, dev, info->extensions,
+                                "EGL_EXT_device_persistent_id",
+                                EGL_DRIVER_NAME_EXT);
+    }
+
+    self->num_devices = num_devices;
+    return true;
+}
+
+struct wcore_platform*
+degl_platform_create(void)
+{
+    struct degl_platform *self;
+    bool ok = true;
+
+    self = wcore_calloc(sizeof(*self));
+    if (self == NULL)
+        return NULL;
+
+    ok = wcore_platform_init(&self->wcore);
+    if (!ok)
+        goto error;
+
+    self->linux = linux_platform_create();
+    if (!self->linux)
+        goto error;
+
+    ok = degl_platform_enumerate_devices(self);
+    if (!ok)
+        goto error;
+
+    self->wcore.vtbl = &degl_platform_vtbl;
+    return &self->wcore;
+
+error:
+    degl_platform_destroy(&self->wcore);
+    return NULL;
+}
+
+int32_t
+degl_platform_find_device(struct degl_platform *self, const char *name)
+{
+    char *end;
+    long index;
+
+    if (name == NULL)
+        return 0;
+
+    index = strtol(name, &end, 10);
+    if (*name != '\0' && *end == '\0') {
+        if (index < 0 || index >= self->num_devices) {
+            wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                         "device index %ld is out of range; there are %d "
+                         "devices", index, self->num_devices);
+            return -1;
+        }
+
+        return index;
+    }
+
+    for (int32_t i = 0; i < self->num_devices; ++i) {
+        const struct waffle_device_info *info = &self->device_infos[i];
+
+        if ((info->drm_device_file &&
+             strcmp(name, info->drm_device_file) == 0) ||
+            (info->drm_render_node_file &&
+             strcmp(name, info->drm_render_node_file) == 0))
+            return i;
+    }
+
+    wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                 "no EGL device has index or DRM node \"%s\"", name);
+    return -1;
+}
+
+static int32_t
+degl_device_count(struct wcore_platform *wc_self)
+{
+    return degl_platform(wc_self)->num_devices;
+}
+
+static const struct waffle_device_info*
+degl_device_get_info(struct wcore_platform *wc_self, int32_t index)
+{
+    struct degl_platform *self = degl_platform(wc_self);
+
+    if (index < 0 || index >= self->num_devices) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "device index %d is out of range; there are %d devices",
+                     index, self->num_devices);
+        return NULL;
+    }
+
+    return &self->device_infos[index];
+}
+
+static bool
+degl_dl_can_open(struct wcore_platform *wc_self,
+                 int32_t waffle_dl)
+{
+    return linux_platform_dl_can_open(degl_platform(wc_self)->linux,
+                                      waffle_dl);
+}
+
+static void*
+degl_dl_sym(struct wcore_platform *wc_self,
+            int32_t waffle_dl,
+            const char *name)
+{
+    return linux_platform_dl_sym(degl_platform(wc_self)->linux,
+                                 waffle_dl,
+                                 name);
+}
+
+static void
+degl_dl_sym_array(struct wcore_platform *wc_self,
+                  int32_t waffle_dl,
+                  int32_t count,
+                  const char *const names[],
+                  void *syms[])
+{
+    linux_platform_dl_sym_array(degl_platform(wc_self)->linux,
+                                waffle_dl, count, names, syms);
+}
+
+static void
+degl_get_symbol_cache_stats(struct wcore_platform *wc_self,
+                            struct waffle_symbol_cache_stats *stats)
+{
+    linux_platform_get_symbol_cache_stats(degl_platform(wc_self)->linux, stats);
+}
+
+static void*
+degl_get_proc_address(struct wcore_platform *wc_self,
+                      const char *name)
+{
+    return linux_platform_get_proc_address(degl_platform(wc_self)->linux,
+                                           wc_self, wegl_get_proc_address,
+                                           name);
+}
+
+static union waffle_native_config*
+degl_config_get_native(struct wcore_config *wc_config)
+{
+    struct degl_display *dpy = degl_display(wc_config->display);
+    struct wegl_config *config = wegl_config(wc_config);
+    union waffle_native_config *n_config;
+
+    WCORE_CREATE_NATIVE_UNION(n_config, device_egl);
+    if (!n_config)
+        return NULL;
+
+    degl_display_fill_native(dpy, &n_config->device_egl->display);
+    n_config->device_egl->egl_config = config->egl;
+
+    return n_config;
+}
+
+static union waffle_native_context*
+degl_context_get_native(struct wcore_context *wc_ctx)
+{
+    struct degl_display *dpy = degl_display(wc_ctx->display);
+    struct wegl_context *ctx = wegl_context(wc_ctx);
+    union waffle_native_context *n_ctx;
+
+    WCORE_CREATE_NATIVE_UNION(n_ctx, device_egl);
+    if (!n_ctx)
+        return NULL;
+
+    degl_display_fill_native(dpy, &n_ctx->device_egl->display);
+    n_ctx->device_egl->egl_context = ctx->egl;
+
+    return n_ctx;
+}
+
+static const struct wcore_platform_vtbl degl_platform_vtbl = {
+    .destroy = degl_platform_destroy,
+
+    .make_current = wegl_make_current,
+    .get_proc_address = degl_get_proc_address,
+    .dl_can_open = degl_dl_can_open,
+    .dl_sym = degl_dl_sym,
+    .dl_sym_array = degl_dl_sym_array,
+    .get_symbol_cache_stats = degl_get_symbol_cache_stats,
+
+    .device_count = degl_device_count,
+    .device_get_info = degl_device_get_info,
+
+    .display = {
+        .connect = degl_display_connect,
+        .destroy = degl_display_destroy,
+        .supports_context_api = wegl_display_supports_context_api,
+        .get_native = degl_display_get_native,
+    },
+
+    .config = {
+        .choose = wegl_config_choose,
+        .destroy = wegl_config_destroy,
+        .get_native = degl_config_get_native,
+        .get_attrib = wegl_config_get_attrib,
+    },
+
+    .context = {
+        .create = wegl_context_create,
+        .destroy = wegl_context_destroy,
+        .get_native = degl_context_get_native,
+        .get_priority = wegl_context_get_priority,
+    },
+
+    .window = {
+        .create = degl_window_create,
+        .destroy = degl_window_destroy,
+        .show = degl_window_show,
+        .swap_buffers = wegl_window_swap_buffers,
+        .swap_buffers_with_damage = wegl_window_swap_buffers_with_damage,
+        .get_buffer_age = wegl_window_get_buffer_age,
+        .set_damage_region = wegl_window_set_damage_region,
+        .set_swap_interval = wegl_window_set_swap_interval,
+        .get_native = degl_window_get_native,
+    },
+
+    .fence = {
+        .create = wegl_fence_create,
+        .destroy = wegl_fence_destroy,
+        .wait = wegl_fence_wait,
+        .export_fd = wegl_fence_export_fd,
+    },
+};
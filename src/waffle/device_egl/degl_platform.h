@@ -0,0 +1,70 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#undef linux
+
+#include "waffle.h"
+
+#include "wcore_platform.h"
+#include "wcore_util.h"
+
+struct linux_platform;
+
+struct degl_platform {
+    struct wcore_platform wcore;
+    struct linux_platform *linux;
+
+    /// @brief Devices, enumerated once when the platform is created.
+    ///
+    /// The array index is also the device's index in waffle_device_info.
+    EGLDeviceEXT *devices;
+    struct waffle_device_info *device_infos;
+    int32_t num_devices;
+};
+
+DEFINE_CONTAINER_CAST_FUNC(degl_platform,
+                           struct degl_platform,
+                           struct wcore_platform,
+                           wcore)
+
+struct wcore_platform*
+degl_platform_create(void);
+
+/// @brief Find a device by the name given to waffle_display_connect().
+///
+/// @a name is either a decimal device index or the path of the device's DRM
+/// device file or render node. If @a name is null, choose device 0.
+///
+/// @return the device's index, or -1 and emit an error.
+int32_t
+degl_platform_find_device(struct degl_platform *self, const char *name);
@@ -23,11 +23,15 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <stdlib.h>
+
 #include <EGL/egl.h>
 #include <EGL/eglext.h>
 
 #include "wcore_config_attrs.h"
+#include "wcore_config_rank.h"
 #include "wcore_error.h"
+#include "wcore_util.h"
 #include "wcore_platform.h"
 
 #include "wegl_config.h"
@@ -54,6 +58,36 @@ check_context_attrs(struct wegl_display *dpy,
         return false;
     }
 
+    if (attrs->context_no_error && !dpy->KHR_create_context_no_error) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_KHR_create_context_no_error is required in order to "
+                     "request a no-error context");
+        return false;
+    }
+
+    if (attrs->context_release_behavior == WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE &&
+        !dpy->KHR_context_flush_control) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_KHR_context_flush_control is required in order to "
+                     "request WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE");
+        return false;
+    }
+
+    if (attrs->context_priority != WAFFLE_DONT_CARE &&
+        !dpy->IMG_context_priority) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_IMG_context_priority is required in order to "
+                     "request WAFFLE_CONTEXT_PRIORITY");
+        return false;
+    }
+
+    if (attrs->context_no_config && !dpy->KHR_no_config_context) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_KHR_no_config_context is required in order to "
+                     "request WAFFLE_CONTEXT_NO_CONFIG");
+        return false;
+    }
+
     switch (attrs->context_api) {
         case WAFFLE_CONTEXT_OPENGL:
             if (attrs->context_full_version != 10 && !dpy->KHR_create_context) {
@@ -125,6 +159,137 @@ check_context_attrs(struct wegl_display *dpy,
     }
 }
 
+/// @brief Map a waffle attribute that names a buffer size to EGL.
+static EGLint
+egl_size_attrib(int32_t waffle_attrib)
+{
+    switch (waffle_attrib) {
+        case WAFFLE_RED_SIZE:       return EGL_RED_SIZE;
+        case WAFFLE_GREEN_SIZE:     return EGL_GREEN_SIZE;
+        case WAFFLE_BLUE_SIZE:      return EGL_BLUE_SIZE;
+        case WAFFLE_ALPHA_SIZE:     return EGL_ALPHA_SIZE;
+        case WAFFLE_DEPTH_SIZE:     return EGL_DEPTH_SIZE;
+        case WAFFLE_STENCIL_SIZE:   return EGL_STENCIL_SIZE;
+        case WAFFLE_SAMPLE_BUFFERS: return EGL_SAMPLE_BUFFERS;
+        case WAFFLE_SAMPLES:        return EGL_SAMPLES;
+        default:                    return EGL_NONE;
+    }
+}
+
+static bool
+get_config_sizes(struct wegl_display *dpy, EGLConfig config,
+                 struct wcore_config_sizes *sizes)
+{
+    EGLint values[8];
+    const EGLint attribs[8] = {
+        EGL_RED_SIZE, EGL_GREEN_SIZE, EGL_BLUE_SIZE, EGL_ALPHA_SIZE,
+        EGL_DEPTH_SIZE, EGL_STENCIL_SIZE, EGL_SAMPLES, EGL_CONFIG_CAVEAT,
+    };
+
+    for (int i = 0; i < 8; ++i) {
+        if (!eglGetConfigAttrib(dpy->egl, config, attribs[i], &values[i]))
+            return false;
+    }
+
+    sizes->red_size = values[0];
+    sizes->green_size = values[1];
+    sizes->blue_size = values[2];
+    sizes->alpha_size = values[3];
+    sizes->depth_size = values[4];
+    sizes->stencil_size = values[5];
+    sizes->samples = values[6];
+
+    switch (values[7]) {
+        case EGL_SLOW_CONFIG:
+            sizes->caveat = WCORE_CONFIG_CAVEAT_SLOW;
+            break;
+        case EGL_NON_CONFORMANT_CONFIG:
+            sizes->caveat = WCORE_CONFIG_CAVEAT_NON_CONFORMANT;
+            break;
+        default:
+            sizes->caveat = WCORE_CONFIG_CAVEAT_NONE;
+            break;
+    }
+
+    return true;
+}
+
+/// @brief Choose among all configs that match @a attrib_list.
+///
+/// eglChooseConfig() treats the sizes as minimums and sorts deeper color
+/// buffers first, so a request for RGB565 would otherwise yield RGBA8888.
+/// An explicit color format must therefore match exactly, and
+/// WAFFLE_CONFIG_SELECTION_SMALLEST ranks the candidates by footprint.
+static EGLConfig
+choose_from_all_configs(struct wegl_display *dpy,
+                        const EGLint *attrib_list,
+                        const struct wcore_config_attrs *attrs)
+{
+    EGLConfig *configs = NULL;
+    struct wcore_config_sizes *sizes = NULL;
+    EGLConfig config = NULL;
+    EGLint num_configs = 0;
+    int num_candidates = 0;
+
+    if (!eglChooseConfig(dpy->egl, attrib_list, NULL, 0, &num_configs)) {
+        wegl_emit_error("eglChooseConfig");
+        return NULL;
+    }
+
+    if (num_configs > 0) {
+        configs = wcore_calloc(num_configs * sizeof(*configs));
+        sizes = wcore_calloc(num_configs * sizeof(*sizes));
+        if (!configs || !sizes)
+            goto done;
+
+        if (!eglChooseConfig(dpy->egl, attrib_list, configs, num_configs,
+                             &num_configs)) {
+            wegl_emit_error("eglChooseConfig");
+            goto done;
+        }
+    }
+
+    // Compact the candidates in place, in the native sort order.
+    for (EGLint i = 0; i < num_configs; ++i) {
+        struct wcore_config_sizes *s = &sizes[num_candidates];
+
+        if (!get_config_sizes(dpy, configs[i], s))
+            continue;
+
+        if (attrs->color_format != WAFFLE_DONT_CARE &&
+            (s->red_size != attrs->red_size ||
+             s->green_size != attrs->green_size ||
+             s->blue_size != attrs->blue_size ||
+             s->alpha_size != attrs->alpha_size))
+            continue;
+
+        configs[num_candidates++] = configs[i];
+    }
+
+    if (num_candidates > 0) {
+        int best = 0;
+
+        if (attrs->config_selection == WAFFLE_CONFIG_SELECTION_SMALLEST)
+            best = wcore_config_rank_smallest(sizes, num_candidates);
+
+        config = configs[best];
+    }
+    else if (attrs->color_format != WAFFLE_DONT_CARE) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "no EGLConfig has the color format %s",
+                     wcore_enum_to_string(attrs->color_format));
+    }
+    else {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "eglChooseConfig found no matching configs");
+    }
+
+done:
+    free(configs);
+    free(sizes);
+    return config;
+}
+
 static EGLConfig
 choose_real_config(struct wegl_display *dpy,
                    const struct wcore_config_attrs *attrs)
@@ -138,8 +303,29 @@ choose_real_config(struct wegl_display *dpy,
         return NULL;
     }
 
-    // WARNING: If you resize attrib_list, then update renderable_index.
+    if (attrs->color_format == WAFFLE_COLOR_FORMAT_RGBA16F &&
+        !dpy->EXT_pixel_format_float) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_EXT_pixel_format_float is required in order to "
+                     "request WAFFLE_COLOR_FORMAT_RGBA16F");
+        return NULL;
+    }
+
+    // Only window surfaces have a render buffer to switch.
+    if (attrs->mutable_render_buffer &&
+        (!dpy->KHR_mutable_render_buffer ||
+         !(dpy->egl_surface_type & EGL_WINDOW_BIT))) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_KHR_mutable_render_buffer and native windows are "
+                     "required in order to request "
+                     "WAFFLE_MUTABLE_RENDER_BUFFER");
+        return NULL;
+    }
+
+    // WARNING: If you resize attrib_list, then update renderable_index and
+    // component_type_index.
     const int renderable_index = 19;
+    const int component_type_index = 22;
 
     EGLint attrib_list[] = {
         // From page 17 of the EGL 1.4 spec:
@@ -163,12 +349,24 @@ choose_real_config(struct wegl_display *dpy,
         EGL_RENDERABLE_TYPE,        31415926,
 
         // According to the EGL 1.4 spec Table 3.4, the default value of
-        // EGL_SURFACE_BIT is EGL_WINDOW_BIT.  Explicitly set the default here for
-        // the sake of self-documentation.
-        EGL_SURFACE_TYPE,           EGL_WINDOW_BIT,
+        // EGL_SURFACE_BIT is EGL_WINDOW_BIT. Platforms without native windows
+        // request EGL_PBUFFER_BIT instead.
+        EGL_SURFACE_TYPE,           dpy->egl_surface_type |
+                                    (attrs->mutable_render_buffer
+                                        ? EGL_MUTABLE_RENDER_BUFFER_BIT_KHR
+                                        : 0),
+
+        // Replaced by EGL_COLOR_COMPONENT_TYPE_EXT for float formats.
+        EGL_NONE,                   EGL_NONE,
+
         EGL_NONE,
     };
 
+    if (attrs->color_format == WAFFLE_COLOR_FORMAT_RGBA16F) {
+        attrib_list[component_type_index] = EGL_COLOR_COMPONENT_TYPE_EXT;
+        attrib_list[component_type_index + 1] = EGL_COLOR_COMPONENT_TYPE_FLOAT_EXT;
+    }
+
     switch (attrs->context_api) {
         case WAFFLE_CONTEXT_OPENGL:
             attrib_list[renderable_index] = EGL_OPENGL_BIT;
@@ -188,6 +386,10 @@ choose_real_config(struct wegl_display *dpy,
             return NULL;
     }
 
+    if (attrs->color_format != WAFFLE_DONT_CARE ||
+        attrs->config_selection == WAFFLE_CONFIG_SELECTION_SMALLEST)
+        return choose_from_all_configs(dpy, attrib_list, attrs);
+
     EGLint num_configs = 0;
     ok &= eglChooseConfig(dpy->egl,
                           attrib_list, &config, 1, &num_configs);
@@ -221,13 +423,26 @@ wegl_config_choose(struct wcore_platform *wc_plat,
     if (!ok)
         goto fail;
 
+    // The cache holds only configs that passed check_context_attrs().
+    if (wcore_config_cache_lookup(&wc_dpy->config_cache, attrs,
+                                  &config->egl, sizeof(config->egl)))
+        return &config->wcore;
+
     if (!check_context_attrs(dpy, attrs))
         goto fail;
 
+    // The surface attributes are irrelevant, as no surface can be created.
+    if (attrs->context_no_config) {
+        config->egl = EGL_NO_CONFIG_KHR;
+        return &config->wcore;
+    }
+
     config->egl = choose_real_config(dpy, attrs);
     if (!config->egl)
         goto fail;
 
+    wcore_config_cache_insert(&wc_dpy->config_cache, attrs,
+                              &config->egl, sizeof(config->egl));
     return &config->wcore;
 
 fail:
@@ -248,3 +463,22 @@ wegl_config_destroy(struct wcore_config *wc_config)
     free(config);
     return result;
 }
+
+bool
+wegl_config_get_attrib(struct wcore_config *wc_config,
+                       int32_t attrib,
+                       int32_t *value)
+{
+    struct wegl_config *config = wegl_config(wc_config);
+    struct wegl_display *dpy = wegl_display(wc_config->display);
+    EGLint egl_value;
+
+    if (!eglGetConfigAttrib(dpy->egl, config->egl, egl_size_attrib(attrib),
+                            &egl_value)) {
+        wegl_emit_error("eglGetConfigAttrib");
+        return false;
+    }
+
+    *value = egl_value;
+    return true;
+}
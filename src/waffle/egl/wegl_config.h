@@ -54,3 +54,8 @@ wegl_config_choose(struct wcore_platform *wc_plat,
 
 bool
 wegl_config_destroy(struct wcore_config *wc_config);
+
+bool
+wegl_config_get_attrib(struct wcore_config *wc_config,
+                       int32_t attrib,
+                       int32_t *value);
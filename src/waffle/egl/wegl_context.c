@@ -140,6 +140,45 @@ create_real_context(struct wegl_config *config,
         attrib_list[i++] = context_flags;
     }
 
+    if (attrs->context_no_error) {
+        assert(dpy->KHR_create_context_no_error);
+        attrib_list[i++] = EGL_CONTEXT_OPENGL_NO_ERROR_KHR;
+        attrib_list[i++] = EGL_TRUE;
+    }
+
+    // Without the extension, every context flushes on release, which is
+    // what WAFFLE_CONTEXT_RELEASE_BEHAVIOR_FLUSH asks for.
+    if (dpy->KHR_context_flush_control) {
+        switch (attrs->context_release_behavior) {
+            case WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE:
+                attrib_list[i++] = EGL_CONTEXT_RELEASE_BEHAVIOR_KHR;
+                attrib_list[i++] = EGL_CONTEXT_RELEASE_BEHAVIOR_NONE_KHR;
+                break;
+            case WAFFLE_CONTEXT_RELEASE_BEHAVIOR_FLUSH:
+                attrib_list[i++] = EGL_CONTEXT_RELEASE_BEHAVIOR_KHR;
+                attrib_list[i++] = EGL_CONTEXT_RELEASE_BEHAVIOR_FLUSH_KHR;
+                break;
+        }
+    }
+    else {
+        assert(attrs->context_release_behavior != WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE);
+    }
+
+    switch (attrs->context_priority) {
+        case WAFFLE_CONTEXT_PRIORITY_HIGH:
+            attrib_list[i++] = EGL_CONTEXT_PRIORITY_LEVEL_IMG;
+            attrib_list[i++] = EGL_CONTEXT_PRIORITY_HIGH_IMG;
+            break;
+        case WAFFLE_CONTEXT_PRIORITY_MEDIUM:
+            attrib_list[i++] = EGL_CONTEXT_PRIORITY_LEVEL_IMG;
+            attrib_list[i++] = EGL_CONTEXT_PRIORITY_MEDIUM_IMG;
+            break;
+        case WAFFLE_CONTEXT_PRIORITY_LOW:
+            attrib_list[i++] = EGL_CONTEXT_PRIORITY_LEVEL_IMG;
+            attrib_list[i++] = EGL_CONTEXT_PRIORITY_LOW_IMG;
+            break;
+    }
+
     attrib_list[i++] = EGL_NONE;
 
     ok = bind_api(waffle_context_api);
@@ -210,3 +249,40 @@ wegl_context_destroy(struct wcore_context *wc_ctx)
     free(ctx);
     return result;
 }
+
+bool
+wegl_context_get_priority(struct wcore_context *wc_ctx, int32_t *priority)
+{
+    struct wegl_context *ctx = wegl_context(wc_ctx);
+    struct wegl_display *dpy = wegl_display(wc_ctx->display);
+    EGLint level;
+
+    if (!dpy->IMG_context_priority) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_IMG_context_priority is not supported");
+        return false;
+    }
+
+    if (!eglQueryContext(dpy->egl, ctx->egl,
+                         EGL_CONTEXT_PRIORITY_LEVEL_IMG, &level)) {
+        wegl_emit_error("eglQueryContext");
+        return false;
+    }
+
+    switch (level) {
+        case EGL_CONTEXT_PRIORITY_HIGH_IMG:
+            *priority = WAFFLE_CONTEXT_PRIORITY_HIGH;
+            return true;
+        case EGL_CONTEXT_PRIORITY_MEDIUM_IMG:
+            *priority = WAFFLE_CONTEXT_PRIORITY_MEDIUM;
+            return true;
+        case EGL_CONTEXT_PRIORITY_LOW_IMG:
+            *priority = WAFFLE_CONTEXT_PRIORITY_LOW;
+            return true;
+        default:
+            wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                         "eglQueryContext returned unknown priority 0x%x",
+                         level);
+            return false;
+    }
+}
@@ -52,3 +52,6 @@ wegl_context_create(struct wcore_platform *wc_plat,
 
 bool
 wegl_context_destroy(struct wcore_context *wc_ctx);
+
+bool
+wegl_context_get_priority(struct wcore_context *wc_ctx, int32_t *priority);
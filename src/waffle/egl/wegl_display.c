@@ -48,10 +48,80 @@ get_extensions(struct wegl_display *dpy)
     assert(wcore_error_get_code() == 0);
 
     dpy->KHR_create_context = waffle_is_extension_in_string(extensions, "EGL_KHR_create_context");
+    dpy->KHR_create_context_no_error = waffle_is_extension_in_string(extensions, "EGL_KHR_create_context_no_error");
+    dpy->KHR_context_flush_control = waffle_is_extension_in_string(extensions, "EGL_KHR_context_flush_control");
+    dpy->IMG_context_priority = waffle_is_extension_in_string(extensions, "EGL_IMG_context_priority");
+    dpy->KHR_mutable_render_buffer = waffle_is_extension_in_string(extensions, "EGL_KHR_mutable_render_buffer");
+    dpy->KHR_no_config_context = waffle_is_extension_in_string(extensions, "EGL_KHR_no_config_context");
+
+    dpy->EXT_pixel_format_float = waffle_is_extension_in_string(extensions, "EGL_EXT_pixel_format_float");
+
+    // EGL_KHR_partial_update also defines the EGL_BUFFER_AGE query.
+    if (waffle_is_extension_in_string(extensions, "EGL_KHR_partial_update")) {
+        dpy->set_damage_region = (PFNEGLSETDAMAGEREGIONKHRPROC)
+            eglGetProcAddress("eglSetDamageRegionKHR");
+    }
+    dpy->EXT_buffer_age = dpy->set_damage_region
+        || waffle_is_extension_in_string(extensions, "EGL_EXT_buffer_age");
+
+    if (waffle_is_extension_in_string(extensions, "EGL_EXT_image_dma_buf_import_modifiers")) {
+        dpy->query_dmabuf_modifiers = (PFNEGLQUERYDMABUFMODIFIERSEXTPROC)
+            eglGetProcAddress("eglQueryDmaBufModifiersEXT");
+    }
+
+    // The KHR and EXT variants have identical signatures and semantics.
+    if (waffle_is_extension_in_string(extensions, "EGL_KHR_swap_buffers_with_damage")) {
+        dpy->swap_buffers_with_damage = (PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC)
+            eglGetProcAddress("eglSwapBuffersWithDamageKHR");
+    }
+    else if (waffle_is_extension_in_string(extensions, "EGL_EXT_swap_buffers_with_damage")) {
+        dpy->swap_buffers_with_damage = (PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC)
+            eglGetProcAddress("eglSwapBuffersWithDamageEXT");
+    }
+
+    if (waffle_is_extension_in_string(extensions, "EGL_KHR_fence_sync")) {
+        dpy->create_sync = (PFNEGLCREATESYNCKHRPROC)
+            eglGetProcAddress("eglCreateSyncKHR");
+        dpy->destroy_sync = (PFNEGLDESTROYSYNCKHRPROC)
+            eglGetProcAddress("eglDestroySyncKHR");
+        dpy->client_wait_sync = (PFNEGLCLIENTWAITSYNCKHRPROC)
+            eglGetProcAddress("eglClientWaitSyncKHR");
+
+        if (!dpy->create_sync || !dpy->destroy_sync ||
+            !dpy->client_wait_sync) {
+            dpy->create_sync = NULL;
+            dpy->destroy_sync = NULL;
+            dpy->client_wait_sync = NULL;
+        }
+    }
+
+    // A native fence is also a fence sync, so it needs the entry points
+    // above for waits.
+    if (dpy->create_sync &&
+        waffle_is_extension_in_string(extensions, "EGL_ANDROID_native_fence_sync")) {
+        dpy->dup_native_fence_fd = (PFNEGLDUPNATIVEFENCEFDANDROIDPROC)
+            eglGetProcAddress("eglDupNativeFenceFDANDROID");
+    }
 
     return true;
 }
 
+/// @brief Initialize the EGLDisplay and query its extensions.
+static bool
+initialize(struct wegl_display *dpy)
+{
+    bool ok;
+    EGLint major, minor;
+
+    ok = eglInitialize(dpy->egl, &major, &minor);
+    if (!ok) {
+        wegl_emit_error("eglInitialize");
+        return false;
+    }
+
+    return get_extensions(dpy);
+}
+
 /// On Linux, according to eglplatform.h, EGLNativeDisplayType and intptr_t
 /// have the same size regardless of platform.
 bool
@@ -60,27 +130,75 @@ wegl_display_init(struct wegl_display *dpy,
                   intptr_t native_display)
 {
     bool ok;
-    EGLint major, minor;
 
     ok = wcore_display_init(&dpy->wcore, wc_plat);
     if (!ok)
         goto fail;
 
+    dpy->egl_surface_type = EGL_WINDOW_BIT;
+
     dpy->egl = eglGetDisplay((EGLNativeDisplayType) native_display);
     if (!dpy->egl) {
         wegl_emit_error("eglGetDisplay");
         goto fail;
     }
 
-    ok = eglInitialize(dpy->egl, &major, &minor);
-    if (!ok) {
-        wegl_emit_error("eglInitialize");
+    ok = initialize(dpy);
+    if (!ok)
+        goto fail;
+
+    return true;
+
+fail:
+    wegl_display_teardown(dpy);
+    return false;
+}
+
+bool
+wegl_display_init_platform(struct wegl_display *dpy,
+                           struct wcore_platform *wc_plat,
+                           EGLenum egl_platform,
+                           void *native_display)
+{
+    PFNEGLGETPLATFORMDISPLAYEXTPROC get_platform_display;
+    const char *client_extensions;
+    bool ok;
+
+    ok = wcore_display_init(&dpy->wcore, wc_plat);
+    if (!ok)
+        goto fail;
+
+    dpy->egl_surface_type = EGL_WINDOW_BIT;
+
+    // Client extensions are queried on EGL_NO_DISPLAY. Old EGL
+    // implementations return null there and set EGL_BAD_DISPLAY.
+    client_extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if (!client_extensions ||
+        !waffle_is_extension_in_string(client_extensions,
+                                       "EGL_EXT_platform_base")) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_EXT_platform_base is not supported");
+        goto fail;
+    }
+
+    get_platform_display = (PFNEGLGETPLATFORMDISPLAYEXTPROC)
+        eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (!get_platform_display) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "eglGetProcAddress(\"eglGetPlatformDisplayEXT\") "
+                     "failed");
         goto fail;
     }
 
-    ok = get_extensions(dpy);
+    dpy->egl = get_platform_display(egl_platform, native_display, NULL);
+    if (!dpy->egl) {
+        wegl_emit_error("eglGetPlatformDisplayEXT");
+        goto fail;
+    }
+
+    ok = initialize(dpy);
     if (!ok)
-	goto fail;
+        goto fail;
 
     return true;
 
@@ -100,6 +218,10 @@ wegl_display_teardown(struct wegl_display *dpy)
             wegl_emit_error("eglTerminate");
     }
 
+    // The display may have failed before wcore_display_init().
+    if (dpy->wcore.platform)
+        ok &= wcore_display_teardown(&dpy->wcore);
+
     return ok;
 }
 
@@ -32,12 +32,52 @@
 
 #include "wcore_display.h"
 
+#include "wegl_imports.h"
+
 struct wcore_display;
 
 struct wegl_display {
     struct wcore_display wcore;
     EGLDisplay egl;
     bool KHR_create_context;
+    bool KHR_create_context_no_error;
+    bool KHR_context_flush_control;
+    bool IMG_context_priority;
+    bool KHR_mutable_render_buffer;
+    bool KHR_no_config_context;
+    bool EXT_buffer_age;
+    bool EXT_pixel_format_float;
+
+    /// @brief eglSetDamageRegionKHR, or null if EGL_KHR_partial_update is
+    /// not supported.
+    PFNEGLSETDAMAGEREGIONKHRPROC set_damage_region;
+
+    /// @brief eglQueryDmaBufModifiersEXT, or null if
+    /// EGL_EXT_image_dma_buf_import_modifiers is not supported.
+    PFNEGLQUERYDMABUFMODIFIERSEXTPROC query_dmabuf_modifiers;
+
+    /// @brief eglSwapBuffersWithDamageKHR or eglSwapBuffersWithDamageEXT.
+    ///
+    /// Null if the display supports neither EGL_KHR_swap_buffers_with_damage
+    /// nor EGL_EXT_swap_buffers_with_damage.
+    PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC swap_buffers_with_damage;
+
+    /// @brief Entry points of EGL_KHR_fence_sync.
+    ///
+    /// Null if the display does not support the extension.
+    PFNEGLCREATESYNCKHRPROC create_sync;
+    PFNEGLDESTROYSYNCKHRPROC destroy_sync;
+    PFNEGLCLIENTWAITSYNCKHRPROC client_wait_sync;
+
+    /// @brief eglDupNativeFenceFDANDROID, or null if
+    /// EGL_ANDROID_native_fence_sync is not supported.
+    PFNEGLDUPNATIVEFENCEFDANDROIDPROC dup_native_fence_fd;
+
+    /// @brief Value of EGL_SURFACE_TYPE given to eglChooseConfig.
+    ///
+    /// Defaults to EGL_WINDOW_BIT. Platforms whose windows are not backed by
+    /// native windows override it after initializing the display.
+    EGLint egl_surface_type;
 };
 
 DEFINE_CONTAINER_CAST_FUNC(wegl_display,
@@ -50,6 +90,16 @@ wegl_display_init(struct wegl_display *dpy,
                   struct wcore_platform *wc_plat,
                   intptr_t native_display);
 
+/// @brief Like wegl_display_init(), but use eglGetPlatformDisplayEXT.
+///
+/// @param egl_platform is an EGL_PLATFORM_* enum, such as
+///     EGL_PLATFORM_SURFACELESS_MESA.
+bool
+wegl_display_init_platform(struct wegl_display *dpy,
+                           struct wcore_platform *wc_plat,
+                           EGLenum egl_platform,
+                           void *native_display);
+
 bool
 wegl_display_teardown(struct wegl_display *dpy);
 
@@ -0,0 +1,153 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdlib.h>
+
+#include "wcore_error.h"
+
+#include "wegl_display.h"
+#include "wegl_fence.h"
+#include "wegl_imports.h"
+#include "wegl_util.h"
+
+static struct wegl_display*
+fence_display(struct wegl_fence *self)
+{
+    return wegl_display(self->wcore.display);
+}
+
+struct wcore_fence*
+wegl_fence_create(struct wcore_platform *wc_plat,
+                  struct wcore_context *wc_ctx)
+{
+    struct wegl_display *dpy = wegl_display(wc_ctx->display);
+    struct wegl_fence *self;
+    EGLint status;
+    bool ok;
+
+    if (!dpy->create_sync) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_KHR_fence_sync is not supported");
+        return NULL;
+    }
+
+    self = wcore_calloc(sizeof(*self));
+    if (!self)
+        return NULL;
+
+    ok = wcore_fence_init(&self->wcore, wc_ctx);
+    if (!ok)
+        goto error;
+
+    // Prefer a native fence, which is also a fence sync, so that the fence
+    // can be exported. Drivers may refuse one for some client APIs.
+    if (dpy->dup_native_fence_fd) {
+        self->sync = dpy->create_sync(dpy->egl,
+                                      EGL_SYNC_NATIVE_FENCE_ANDROID, NULL);
+        self->native = self->sync != EGL_NO_SYNC_KHR;
+    }
+
+    if (!self->sync)
+        self->sync = dpy->create_sync(dpy->egl, EGL_SYNC_FENCE_KHR, NULL);
+
+    if (!self->sync) {
+        wegl_emit_error("eglCreateSyncKHR");
+        goto error;
+    }
+
+    // Flush the fence, so that a wait in another thread terminates and a
+    // native fence gets its file descriptor.
+    status = dpy->client_wait_sync(dpy->egl, self->sync,
+                                   EGL_SYNC_FLUSH_COMMANDS_BIT_KHR, 0);
+    if (status == EGL_FALSE) {
+        wegl_emit_error("eglClientWaitSyncKHR");
+        dpy->destroy_sync(dpy->egl, self->sync);
+        goto error;
+    }
+
+    return &self->wcore;
+
+error:
+    free(self);
+    return NULL;
+}
+
+bool
+wegl_fence_destroy(struct wcore_fence *wc_self)
+{
+    struct wegl_fence *self = wegl_fence(wc_self);
+    struct wegl_display *dpy = fence_display(self);
+    bool ok;
+
+    ok = dpy->destroy_sync(dpy->egl, self->sync);
+    if (!ok)
+        wegl_emit_error("eglDestroySyncKHR");
+
+    ok &= wcore_fence_teardown(&self->wcore);
+    free(self);
+    return ok;
+}
+
+bool
+wegl_fence_wait(struct wcore_fence *wc_self,
+                uint64_t timeout_ns,
+                bool *signaled)
+{
+    struct wegl_fence *self = wegl_fence(wc_self);
+    struct wegl_display *dpy = fence_display(self);
+    EGLint status;
+
+    // UINT64_MAX is EGL_FOREVER_KHR.
+    status = dpy->client_wait_sync(dpy->egl, self->sync, 0, timeout_ns);
+    if (status == EGL_FALSE) {
+        wegl_emit_error("eglClientWaitSyncKHR");
+        return false;
+    }
+
+    *signaled = status == EGL_CONDITION_SATISFIED_KHR;
+    return true;
+}
+
+int
+wegl_fence_export_fd(struct wcore_fence *wc_self)
+{
+    struct wegl_fence *self = wegl_fence(wc_self);
+    struct wegl_display *dpy = fence_display(self);
+    EGLint fd;
+
+    if (!self->native) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_ANDROID_native_fence_sync is not supported");
+        return -1;
+    }
+
+    fd = dpy->dup_native_fence_fd(dpy->egl, self->sync);
+    if (fd == EGL_NO_NATIVE_FENCE_FD_ANDROID) {
+        wegl_emit_error("eglDupNativeFenceFDANDROID");
+        return -1;
+    }
+
+    return fd;
+}
@@ -83,10 +83,20 @@ wegl_make_current(struct wcore_platform *wc_plat,
                         wc_ctx
                             ? wegl_context(wc_ctx)->egl
                             : NULL);
-    if (!ok)
+    if (!ok) {
         wegl_emit_error("eglMakeCurrent");
+        return false;
+    }
+
+    // A deferred swap interval is best-effort. The context is bound, so
+    // the bind must succeed without leaving an error behind.
+    if (wc_window) {
+        WCORE_ERROR_DISABLED({
+            wegl_window_apply_swap_interval(wegl_window(wc_window));
+        });
+    }
 
-    return ok;
+    return true;
 }
 
 void*
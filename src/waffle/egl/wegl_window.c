@@ -23,6 +23,8 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include "wcore_error.h"
+
 #include "wegl_config.h"
 #include "wegl_display.h"
 #include "wegl_imports.h"
@@ -64,6 +66,47 @@ wegl_window_init(struct wegl_window *window,
         goto fail;
     }
 
+    // The EGL 1.4 spec, Section 3.9.3, states that the default is 1.
+    window->egl_config = config->egl;
+    window->swap_interval = 1;
+    window->mutable_render_buffer = config->wcore.attrs.mutable_render_buffer;
+
+    return true;
+
+fail:
+    wegl_window_teardown(window);
+    return false;
+}
+
+bool
+wegl_pbuffer_init(struct wegl_window *window,
+                  struct wcore_config *wc_config,
+                  int32_t width,
+                  int32_t height)
+{
+    struct wegl_config *config = wegl_config(wc_config);
+    struct wegl_display *dpy = wegl_display(wc_config->display);
+    bool ok;
+
+    ok = wcore_window_init(&window->wcore, wc_config);
+    if (!ok)
+        goto fail;
+
+    EGLint attrib_list[] = {
+        EGL_WIDTH, width,
+        EGL_HEIGHT, height,
+        EGL_NONE,
+    };
+
+    window->egl = eglCreatePbufferSurface(dpy->egl, config->egl, attrib_list);
+    if (!window->egl) {
+        wegl_emit_error("eglCreatePbufferSurface");
+        goto fail;
+    }
+
+    window->egl_config = config->egl;
+    window->swap_interval = 1;
+
     return true;
 
 fail:
@@ -101,3 +144,170 @@ wegl_window_swap_buffers(struct wcore_window *wc_window)
 
     return ok;
 }
+
+bool
+wegl_window_swap_buffers_with_damage(struct wcore_window *wc_window,
+                                     const int32_t *rects,
+                                     int32_t n_rects)
+{
+    struct wegl_window *window = wegl_window(wc_window);
+    struct wegl_display *dpy = wegl_display(window->wcore.display);
+
+    if (!dpy->swap_buffers_with_damage)
+        return wegl_window_swap_buffers(wc_window);
+
+    bool ok = dpy->swap_buffers_with_damage(dpy->egl, window->egl,
+                                            (const EGLint *) rects, n_rects);
+    if (!ok)
+        wegl_emit_error("eglSwapBuffersWithDamage");
+
+    return ok;
+}
+
+bool
+wegl_window_get_buffer_age(struct wcore_window *wc_window, int32_t *age)
+{
+    struct wegl_window *window = wegl_window(wc_window);
+    struct wegl_display *dpy = wegl_display(window->wcore.display);
+    EGLint value;
+
+    if (!dpy->EXT_buffer_age) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_EXT_buffer_age and EGL_KHR_partial_update are "
+                     "not supported");
+        return false;
+    }
+
+    if (!eglQuerySurface(dpy->egl, window->egl, EGL_BUFFER_AGE_EXT, &value)) {
+        wegl_emit_error("eglQuerySurface(EGL_BUFFER_AGE_EXT)");
+        return false;
+    }
+
+    *age = value;
+    return true;
+}
+
+bool
+wegl_window_set_damage_region(struct wcore_window *wc_window,
+                              const int32_t *rects,
+                              int32_t n_rects)
+{
+    struct wegl_window *window = wegl_window(wc_window);
+    struct wegl_display *dpy = wegl_display(window->wcore.display);
+
+    if (!dpy->set_damage_region) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_KHR_partial_update is not supported");
+        return false;
+    }
+
+    // EGL_KHR_partial_update applies only to window surfaces.
+    if (!(dpy->egl_surface_type & EGL_WINDOW_BIT)) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "damage regions require window surfaces");
+        return false;
+    }
+
+    // eglSetDamageRegionKHR does not modify the rectangles; its prototype
+    // merely lacks the const.
+    if (!dpy->set_damage_region(dpy->egl, window->egl,
+                                (EGLint *) rects, n_rects)) {
+        wegl_emit_error("eglSetDamageRegionKHR");
+        return false;
+    }
+
+    return true;
+}
+
+bool
+wegl_window_set_swap_interval(struct wcore_window *wc_window,
+                              int32_t interval)
+{
+    struct wegl_window *window = wegl_window(wc_window);
+    struct wegl_display *dpy = wegl_display(window->wcore.display);
+    EGLint min_interval = 0, max_interval = 0;
+    bool ok;
+
+    if (interval < 0) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL does not support adaptive swap intervals");
+        return false;
+    }
+
+    // eglSwapInterval silently clamps the interval, so check the range here.
+    ok = eglGetConfigAttrib(dpy->egl, window->egl_config,
+                            EGL_MIN_SWAP_INTERVAL, &min_interval)
+      && eglGetConfigAttrib(dpy->egl, window->egl_config,
+                            EGL_MAX_SWAP_INTERVAL, &max_interval);
+    if (!ok) {
+        wegl_emit_error("eglGetConfigAttrib");
+        return false;
+    }
+
+    if (interval < min_interval || interval > max_interval) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "swap interval %d is outside the EGLConfig's range "
+                     "[%d, %d]", interval, min_interval, max_interval);
+        return false;
+    }
+
+    window->swap_interval = interval;
+    window->swap_interval_pending = true;
+
+    if (eglGetCurrentDisplay() == dpy->egl &&
+        eglGetCurrentSurface(EGL_DRAW) == window->egl) {
+        return wegl_window_apply_swap_interval(window);
+    }
+
+    return true;
+}
+
+bool
+wegl_window_apply_swap_interval(struct wegl_window *window)
+{
+    struct wegl_display *dpy = wegl_display(window->wcore.display);
+
+    if (!window->swap_interval_pending)
+        return true;
+
+    // A failed interval is not retried at every bind.
+    window->swap_interval_pending = false;
+
+    if (!eglSwapInterval(dpy->egl, window->swap_interval)) {
+        wegl_emit_error("eglSwapInterval");
+        return false;
+    }
+
+    return true;
+}
+
+bool
+wegl_window_set_render_buffer(struct wcore_window *wc_window,
+                              int32_t buffer)
+{
+    struct wegl_window *window = wegl_window(wc_window);
+    struct wegl_display *dpy = wegl_display(window->wcore.display);
+    EGLint egl_render_buffer;
+
+    if (!window->mutable_render_buffer) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "the window's config was not chosen with "
+                     "WAFFLE_MUTABLE_RENDER_BUFFER");
+        return false;
+    }
+
+    if (buffer == WAFFLE_RENDER_BUFFER_SINGLE)
+        egl_render_buffer = EGL_SINGLE_BUFFER;
+    else
+        egl_render_buffer = EGL_BACK_BUFFER;
+
+    // From the EGL_KHR_mutable_render_buffer spec: the new value takes
+    // effect after the next eglSwapBuffers.
+    if (!eglSurfaceAttrib(dpy->egl, window->egl, EGL_RENDER_BUFFER,
+                          egl_render_buffer)) {
+        wegl_emit_error("eglSurfaceAttrib(EGL_RENDER_BUFFER)");
+        return false;
+    }
+
+    return true;
+}
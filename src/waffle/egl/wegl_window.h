@@ -38,6 +38,19 @@ struct wegl_display;
 struct wegl_window {
     struct wcore_window wcore;
     EGLSurface egl;
+    EGLConfig egl_config;
+
+    /// @brief The interval requested with wegl_window_set_swap_interval().
+    ///
+    /// eglSwapInterval() applies to the draw surface of the current context.
+    /// If the window is not current when the interval is set, then
+    /// @a swap_interval_pending is set and wegl_make_current() applies the
+    /// interval when the window is next bound.
+    EGLint swap_interval;
+    bool swap_interval_pending;
+
+    /// @brief The config was chosen with EGL_MUTABLE_RENDER_BUFFER_BIT_KHR.
+    bool mutable_render_buffer;
 };
 
 DEFINE_CONTAINER_CAST_FUNC(wegl_window,
@@ -50,8 +63,49 @@ wegl_window_init(struct wegl_window *window,
                  struct wcore_config *wc_config,
                  intptr_t native_window);
 
+/// @brief Initialize the window with a pbuffer instead of a native window.
+///
+/// The config must have been chosen with EGL_PBUFFER_BIT. Because a pbuffer
+/// has no back buffer, wegl_window_swap_buffers() has no effect on it.
+bool
+wegl_pbuffer_init(struct wegl_window *window,
+                  struct wcore_config *wc_config,
+                  int32_t width,
+                  int32_t height);
+
 bool
 wegl_window_teardown(struct wegl_window *window);
 
 bool
 wegl_window_swap_buffers(struct wcore_window *wc_window);
+
+/// @brief Swap with eglSwapBuffersWithDamage if available.
+///
+/// Falls back to eglSwapBuffers, which posts the whole surface.
+bool
+wegl_window_swap_buffers_with_damage(struct wcore_window *wc_window,
+                                     const int32_t *rects,
+                                     int32_t n_rects);
+
+bool
+wegl_window_get_buffer_age(struct wcore_window *wc_window, int32_t *age);
+
+bool
+wegl_window_set_damage_region(struct wcore_window *wc_window,
+                              const int32_t *rects,
+                              int32_t n_rects);
+
+bool
+wegl_window_set_swap_interval(struct wcore_window *wc_window,
+                              int32_t interval);
+
+/// @brief Set EGL_RENDER_BUFFER, which takes effect at the next swap.
+bool
+wegl_window_set_render_buffer(struct wcore_window *wc_window,
+                              int32_t buffer);
+
+/// @brief Apply a pending swap interval. The window must be current.
+///
+/// The interval is no longer pending afterwards, even on failure.
+bool
+wegl_window_apply_swap_interval(struct wegl_window *window);
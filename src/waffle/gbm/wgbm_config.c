@@ -45,6 +45,17 @@ wgbm_config_choose(struct wcore_platform *wc_plat,
 uint32_t
 wgbm_config_get_gbm_format(const struct wcore_config_attrs *attrs)
 {
+    switch (attrs->color_format) {
+        case WAFFLE_COLOR_FORMAT_RGB565:
+            return GBM_FORMAT_RGB565;
+        case WAFFLE_COLOR_FORMAT_RGB10_A2:
+            return GBM_FORMAT_ARGB2101010;
+        case WAFFLE_COLOR_FORMAT_RGBA16F:
+            return GBM_FORMAT_ABGR16161616F;
+        default:
+            break;
+    }
+
     if (attrs->red_size > 8 || attrs->blue_size > 8 ||
         attrs->green_size > 8 || attrs->alpha_size > 8) {
         return 0;
@@ -30,6 +30,11 @@
 
 #include <gbm.h>
 
+// Older gbm.h lack the half-float formats.
+#ifndef GBM_FORMAT_ABGR16161616F
+#define GBM_FORMAT_ABGR16161616F __gbm_fourcc_code('A', 'B', '4', 'H')
+#endif
+
 #include "wegl_config.h"
 
 union waffle_native_config;
@@ -30,11 +30,6 @@
 #include <unistd.h>
 
 #include <gbm.h>
-#include <libudev.h>
-#include <fcntl.h>
-#include <sys/types.h>
-#include <sys/stat.h>
-#include <linux/input.h>
 
 #include "wcore_error.h"
 
@@ -64,51 +59,6 @@ wgbm_display_destroy(struct wcore_display *wc_self)
     return ok;
 }
 
-static int
-wgbm_get_default_fd_for_pattern(const char *pattern)
-{
-    struct udev *ud;
-    struct udev_enumerate *en;
-    struct udev_list_entry *entry;
-    const char *path, *filename;
-    struct udev_device *device;
-    int fd;
-
-    ud = udev_new();
-    en = udev_enumerate_new(ud);
-    udev_enumerate_add_match_subsystem(en, "drm");
-    udev_enumerate_add_match_sysname(en, pattern);
-    udev_enumerate_scan_devices(en);
-
-    udev_list_entry_foreach(entry, udev_enumerate_get_list_entry(en)) {
-        path = udev_list_entry_get_name(entry);
-        device = udev_device_new_from_syspath(ud, path);
-        filename = udev_device_get_devnode(device);
-        fd = open(filename, O_RDWR | O_CLOEXEC);
-        udev_device_unref(device);
-        if (fd >= 0) {
-            return fd;
-        }
-    }
-
-    return -1;
-}
-
-static int
-wgbm_get_default_fd(void)
-{
-    int fd;
-
-    // Try opening render node first
-    fd = wgbm_get_default_fd_for_pattern("renderD[0-9]*");
-    if (fd >= 0)
-        return fd;
-
-    // If render nodes are not supported, then fall back to the card
-    fd = wgbm_get_default_fd_for_pattern("card[0-9]*");
-    return fd;
-}
-
 struct wcore_display*
 wgbm_display_connect(struct wcore_platform *wc_plat,
                      const char *name)
@@ -121,20 +71,14 @@ wgbm_display_connect(struct wcore_platform *wc_plat,
     if (self == NULL)
         return NULL;
 
-    if (name != NULL) {
-        fd = open(name, O_RDWR | O_CLOEXEC);
-    } else {
-        fd = wgbm_get_default_fd();
-    }
-
-    if (fd < 0) {
-        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "open drm file for gbm failed");
+    fd = wgbm_platform_open_device(wgbm_platform(wc_plat), name);
+    if (fd < 0)
         goto error;
-    }
 
     self->gbm_device = gbm_create_device(fd);
     if (!self->gbm_device) {
         wcore_errorf(WAFFLE_ERROR_UNKNOWN, "gbm_create_device failed");
+        close(fd);
         goto error;
     }
 
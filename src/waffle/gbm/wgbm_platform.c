@@ -24,9 +24,13 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define __GBM__ 1
-#define _POSIX_C_SOURCE 200112 // glib feature macro for unsetenv()
+#define _POSIX_C_SOURCE 200809L // glibc feature macro for unsetenv(), strdup()
 
+#include <fcntl.h>
 #include <stdlib.h>
+#include <string.h>
+
+#include <libudev.h>
 
 #include "wcore_error.h"
 
@@ -34,7 +38,9 @@
 
 #include "wegl_config.h"
 #include "wegl_context.h"
+#include "wegl_fence.h"
 #include "wegl_util.h"
+#include "wegl_window.h"
 
 #include "wgbm_config.h"
 #include "wgbm_display.h"
@@ -57,11 +63,244 @@ wgbm_platform_destroy(struct wcore_platform *wc_self)
     if (self->linux)
         ok &= linux_platform_destroy(self->linux);
 
+    for (int32_t i = 0; i < self->num_devices; ++i) {
+        struct waffle_device_info *info = &self->device_infos[i];
+
+        free((char *) info->driver_name);
+        free((char *) info->drm_device_file);
+        free((char *) info->drm_render_node_file);
+    }
+    free(self->device_infos);
+
     ok &= wcore_platform_teardown(wc_self);
     free(self);
     return ok;
 }
 
+/// @brief Return the nearest ancestor of a DRM node that is bound to a driver.
+///
+/// The primary node and render node of one device share this ancestor.
+static struct udev_device*
+wgbm_find_driver_device(struct udev_device *node)
+{
+    struct udev_device *parent = udev_device_get_parent(node);
+
+    for (struct udev_device *d = parent; d; d = udev_device_get_parent(d)) {
+        if (udev_device_get_driver(d))
+            return d;
+    }
+
+    return parent;
+}
+
+/// @brief Add the DRM nodes matching @a pattern to the device tables.
+///
+/// @a parents holds, for each device, the syspath that groups its nodes.
+static bool
+wgbm_platform_add_nodes(struct wgbm_platform *self,
+                        struct udev *ud,
+                        const char *pattern,
+                        bool render_node,
+                        char ***parents)
+{
+    struct udev_enumerate *en;
+    struct udev_list_entry *entry;
+    bool ok = true;
+
+    en = udev_enumerate_new(ud);
+    if (!en)
+        return false;
+
+    udev_enumerate_add_match_subsystem(en, "drm");
+    udev_enumerate_add_match_sysname(en, pattern);
+    udev_enumerate_scan_devices(en);
+
+    udev_list_entry_foreach(entry, udev_enumerate_get_list_entry(en)) {
+        struct udev_device *node, *owner;
+        struct waffle_device_info *info = NULL;
+        const char *devnode, *parent, *driver;
+
+        node = udev_device_new_from_syspath(ud, udev_list_entry_get_name(entry));
+        if (!node)
+            continue;
+
+        devnode = udev_device_get_devnode(node);
+        owner = wgbm_find_driver_device(node);
+        parent = owner ? udev_device_get_syspath(owner) : NULL;
+        driver = owner ? udev_device_get_driver(owner) : NULL;
+
+        if (!devnode) {
+            udev_device_unref(node);
+            continue;
+        }
+
+        for (int32_t i = 0; parent && i < self->num_devices; ++i) {
+            if ((*parents)[i] && strcmp((*parents)[i], parent) == 0) {
+                info = &self->device_infos[i];
+                break;
+            }
+        }
+
+        if (!info) {
+            int32_t n = self->num_devices;
+            struct waffle_device_info *infos;
+            char **new_parents;
+
+            infos = realloc(self->device_infos, (n + 1) * sizeof(*infos));
+            if (infos)
+                self->device_infos = infos;
+            new_parents = realloc(*parents, (n + 1) * sizeof(*new_parents));
+            if (new_parents)
+                *parents = new_parents;
+            if (!infos || !new_parents) {
+                wcore_error(WAFFLE_ERROR_BAD_ALLOC);
+                udev_device_unref(node);
+                ok = false;
+                break;
+            }
+
+            info = &self->device_infos[n];
+            memset(info, 0, sizeof(*info));
+            info->index = n;
+            info->driver_name = driver ? strdup(driver) : NULL;
+            (*parents)[n] = parent ? strdup(parent) : NULL;
+            self->num_devices = n + 1;
+        }
+
+        if (render_node && !info->drm_render_node_file)
+            info->drm_render_node_file = strdup(devnode);
+        else if (!render_node && !info->drm_device_file)
+            info->drm_device_file = strdup(devnode);
+
+        udev_device_unref(node);
+    }
+
+    udev_enumerate_unref(en);
+    return ok;
+}
+
+/// @brief Enumerate the DRM devices once, for every later display.
+///
+/// Failure is not fatal: waffle_display_connect() still accepts node paths.
+static void
+wgbm_platform_enumerate_devices(struct wgbm_platform *self)
+{
+    struct udev *ud;
+    char **parents = NULL;
+
+    ud = udev_new();
+    if (!ud)
+        return;
+
+    if (wgbm_platform_add_nodes(self, ud, "card[0-9]*", false, &parents))
+        wgbm_platform_add_nodes(self, ud, "renderD[0-9]*", true, &parents);
+
+    if (parents) {
+        for (int32_t i = 0; i < self->num_devices; ++i)
+            free(parents[i]);
+        free(parents);
+    }
+
+    udev_unref(ud);
+}
+
+static int
+wgbm_open_node(const char *path)
+{
+    if (!path)
+        return -1;
+
+    return open(path, O_RDWR | O_CLOEXEC);
+}
+
+static int
+wgbm_platform_open_index(struct wgbm_platform *self, int32_t index)
+{
+    const struct waffle_device_info *info = &self->device_infos[index];
+    int fd;
+
+    fd = wgbm_open_node(info->drm_render_node_file);
+    if (fd < 0)
+        fd = wgbm_open_node(info->drm_device_file);
+    if (fd < 0)
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "failed to open a DRM node of device %d", index);
+
+    return fd;
+}
+
+int
+wgbm_platform_open_device(struct wgbm_platform *self, const char *name)
+{
+    char *end;
+    long index;
+    int fd;
+
+    if (name == NULL) {
+        // Prefer any render node over every primary node.
+        for (int32_t i = 0; i < self->num_devices; ++i) {
+            fd = wgbm_open_node(self->device_infos[i].drm_render_node_file);
+            if (fd >= 0)
+                return fd;
+        }
+
+        for (int32_t i = 0; i < self->num_devices; ++i) {
+            fd = wgbm_open_node(self->device_infos[i].drm_device_file);
+            if (fd >= 0)
+                return fd;
+        }
+
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "open drm file for gbm failed");
+        return -1;
+    }
+
+    index = strtol(name, &end, 10);
+    if (*name != '\0' && *end == '\0') {
+        if (index < 0 || index >= self->num_devices) {
+            wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                         "device index %ld is out of range; there are %d "
+                         "devices", index, self->num_devices);
+            return -1;
+        }
+
+        return wgbm_platform_open_index(self, index);
+    }
+
+    for (int32_t i = 0; i < self->num_devices; ++i) {
+        const char *driver = self->device_infos[i].driver_name;
+
+        if (driver && strcmp(name, driver) == 0)
+            return wgbm_platform_open_index(self, i);
+    }
+
+    fd = wgbm_open_node(name);
+    if (fd < 0)
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "open drm file for gbm failed");
+
+    return fd;
+}
+
+static int32_t
+wgbm_device_count(struct wcore_platform *wc_self)
+{
+    return wgbm_platform(wc_self)->num_devices;
+}
+
+static const struct waffle_device_info*
+wgbm_device_get_info(struct wcore_platform *wc_self, int32_t index)
+{
+    struct wgbm_platform *self = wgbm_platform(wc_self);
+
+    if (index < 0 || index >= self->num_devices) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "device index %d is out of range; there are %d devices",
+                     index, self->num_devices);
+        return NULL;
+    }
+
+    return &self->device_infos[index];
+}
+
 struct wcore_platform*
 wgbm_platform_create(void)
 {
@@ -82,6 +321,8 @@ wgbm_platform_create(void)
 
     setenv("EGL_PLATFORM", "drm", true);
 
+    wgbm_platform_enumerate_devices(self);
+
     self->wcore.vtbl = &wgbm_platform_vtbl;
     return &self->wcore;
 
@@ -108,6 +349,33 @@ wgbm_dl_sym(struct wcore_platform *wc_self,
                                  name);
 }
 
+static void
+wgbm_dl_sym_array(struct wcore_platform *wc_self,
+                  int32_t waffle_dl,
+                  int32_t count,
+                  const char *const names[],
+                  void *syms[])
+{
+    linux_platform_dl_sym_array(wgbm_platform(wc_self)->linux,
+                                waffle_dl, count, names, syms);
+}
+
+static void
+wgbm_get_symbol_cache_stats(struct wcore_platform *wc_self,
+                            struct waffle_symbol_cache_stats *stats)
+{
+    linux_platform_get_symbol_cache_stats(wgbm_platform(wc_self)->linux, stats);
+}
+
+static void*
+wgbm_get_proc_address(struct wcore_platform *wc_self,
+                      const char *name)
+{
+    return linux_platform_get_proc_address(wgbm_platform(wc_self)->linux,
+                                           wc_self, wegl_get_proc_address,
+                                           name);
+}
+
 static union waffle_native_context*
 wgbm_context_get_native(struct wcore_context *wc_ctx)
 {
@@ -129,9 +397,13 @@ static const struct wcore_platform_vtbl wgbm_platform_vtbl = {
     .destroy = wgbm_platform_destroy,
 
     .make_current = wegl_make_current,
-    .get_proc_address = wegl_get_proc_address,
+    .get_proc_address = wgbm_get_proc_address,
     .dl_can_open = wgbm_dl_can_open,
     .dl_sym = wgbm_dl_sym,
+    .dl_sym_array = wgbm_dl_sym_array,
+    .get_symbol_cache_stats = wgbm_get_symbol_cache_stats,
+    .device_count = wgbm_device_count,
+    .device_get_info = wgbm_device_get_info,
 
     .display = {
         .connect = wgbm_display_connect,
@@ -144,19 +416,36 @@ static const struct wcore_platform_vtbl wgbm_platform_vtbl = {
         .choose = wgbm_config_choose,
         .destroy = wegl_config_destroy,
         .get_native = wgbm_config_get_native,
+        .get_attrib = wegl_config_get_attrib,
     },
 
     .context = {
         .create = wegl_context_create,
         .destroy = wegl_context_destroy,
         .get_native = wgbm_context_get_native,
+        .get_priority = wegl_context_get_priority,
     },
 
     .window = {
         .create = wgbm_window_create,
+        .create_with_modifiers = wgbm_window_create_with_modifiers,
         .destroy = wgbm_window_destroy,
         .show = wgbm_window_show,
-        .swap_buffers = wegl_window_swap_buffers,
+        .swap_buffers = wgbm_window_swap_buffers,
+        .swap_buffers_with_damage = wgbm_window_swap_buffers_with_damage,
+        .get_buffer_age = wegl_window_get_buffer_age,
+        .set_damage_region = wegl_window_set_damage_region,
+        .set_front_buffer_callback = wgbm_window_set_front_buffer_callback,
+        .release_front_buffer = wgbm_window_release_front_buffer,
+        .export_dmabuf = wgbm_window_export_dmabuf,
+        .set_swap_interval = wegl_window_set_swap_interval,
         .get_native = wgbm_window_get_native,
     },
+
+    .fence = {
+        .create = wegl_fence_create,
+        .destroy = wegl_fence_destroy,
+        .wait = wegl_fence_wait,
+        .export_fd = wegl_fence_export_fd,
+    },
 };
@@ -30,6 +30,8 @@
 
 #undef linux
 
+#include "waffle.h"
+
 #include "wcore_platform.h"
 #include "wcore_util.h"
 
@@ -38,6 +40,14 @@ struct linux_platform;
 struct wgbm_platform {
     struct wcore_platform wcore;
     struct linux_platform *linux;
+
+    /// @brief DRM devices, enumerated once when the platform is created.
+    ///
+    /// Each device groups the primary node and render node of one piece of
+    /// hardware. The array index is also the device's index in
+    /// waffle_device_info. The strings are owned by the platform.
+    struct waffle_device_info *device_infos;
+    int32_t num_devices;
 };
 
 DEFINE_CONTAINER_CAST_FUNC(wgbm_platform,
@@ -47,3 +57,13 @@ DEFINE_CONTAINER_CAST_FUNC(wgbm_platform,
 
 struct wcore_platform*
 wgbm_platform_create(void);
+
+/// @brief Open the DRM node named by waffle_display_connect().
+///
+/// @a name is a decimal device index, a driver name, or the path of a DRM
+/// node. For a device, its render node is preferred over its primary node.
+/// If @a name is null, open the first device that can be opened.
+///
+/// @return an fd opened with O_CLOEXEC, or -1 and emit an error.
+int
+wgbm_platform_open_device(struct wgbm_platform *self, const char *name);
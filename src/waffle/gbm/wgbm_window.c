@@ -27,6 +27,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 #include <gbm.h>
 
@@ -35,11 +36,16 @@
 #include "wcore_error.h"
 
 #include "wegl_config.h"
+#include "wegl_util.h"
 
 #include "wgbm_config.h"
 #include "wgbm_display.h"
 #include "wgbm_window.h"
 
+#ifndef DRM_FORMAT_MOD_INVALID
+#define DRM_FORMAT_MOD_INVALID ((1ULL << 56) - 1)
+#endif
+
 bool
 wgbm_window_destroy(struct wcore_window *wc_self)
 {
@@ -49,36 +55,82 @@ wgbm_window_destroy(struct wcore_window *wc_self)
     if (!self)
         return ok;
 
+    // The surface's buffers must be returned before it is destroyed.
+    if (self->front_bo)
+        gbm_surface_release_buffer(self->gbm_surface, self->front_bo);
+    for (int i = 0; i < self->num_consumer_bos; ++i)
+        gbm_surface_release_buffer(self->gbm_surface, self->consumer_bos[i]);
+
     ok &= wegl_window_teardown(&self->wegl);
-    gbm_surface_destroy(self->gbm_surface);
+    if (self->gbm_surface)
+        gbm_surface_destroy(self->gbm_surface);
     free(self);
     return ok;
 }
 
-struct wcore_window*
-wgbm_window_create(struct wcore_platform *wc_plat,
-                   struct wcore_config *wc_config,
-                   int width,
-                   int height)
+/// @brief Return the GBM format of the surface for @a wc_config.
+///
+/// An explicit color format may match configs of several channel orders,
+/// such as ARGB2101010 and ABGR2101010. The surface must use the one of the
+/// chosen config, whose native visual is its GBM format.
+static uint32_t
+wgbm_window_get_gbm_format(struct wcore_config *wc_config)
+{
+    struct wgbm_display *dpy = wgbm_display(wc_config->display);
+    uint32_t gbm_format = wgbm_config_get_gbm_format(&wc_config->attrs);
+    assert(gbm_format != 0);
+
+    if (wc_config->attrs.color_format != WAFFLE_DONT_CARE) {
+        EGLint visual_id = 0;
+        if (eglGetConfigAttrib(dpy->wegl.egl, wegl_config(wc_config)->egl,
+                               EGL_NATIVE_VISUAL_ID, &visual_id) &&
+            visual_id != 0) {
+            gbm_format = visual_id;
+        }
+    }
+
+    return gbm_format;
+}
+
+/// @param modifiers If null, let the driver choose the layout implicitly.
+static struct wcore_window*
+wgbm_window_create_common(struct wcore_config *wc_config,
+                          uint32_t gbm_format,
+                          int width,
+                          int height,
+                          const uint64_t *modifiers,
+                          int32_t num_modifiers)
 {
     struct wgbm_window *self;
     struct wgbm_display *dpy = wgbm_display(wc_config->display);
-    uint32_t gbm_format;
     bool ok = true;
 
     self = wcore_calloc(sizeof(*self));
     if (self == NULL)
         return NULL;
 
-    gbm_format = wgbm_config_get_gbm_format(&wc_config->attrs);
-    assert(gbm_format != 0);
-    self->gbm_surface = gbm_surface_create(dpy->gbm_device, width, height,
-                                           gbm_format,
-                                           GBM_BO_USE_RENDERING);
-    if (!self->gbm_surface) {
-        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
-                     "gbm_surface_create failed");
-        goto error;
+    self->modifier = DRM_FORMAT_MOD_INVALID;
+
+    if (modifiers) {
+        self->gbm_surface =
+            gbm_surface_create_with_modifiers(dpy->gbm_device,
+                                              width, height, gbm_format,
+                                              modifiers, num_modifiers);
+        if (!self->gbm_surface) {
+            wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                         "gbm_surface_create_with_modifiers failed");
+            goto error;
+        }
+    }
+    else {
+        self->gbm_surface = gbm_surface_create(dpy->gbm_device, width, height,
+                                               gbm_format,
+                                               GBM_BO_USE_RENDERING);
+        if (!self->gbm_surface) {
+            wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                         "gbm_surface_create failed");
+            goto error;
+        }
     }
 
     ok = wegl_window_init(&self->wegl, wc_config,
@@ -93,6 +145,110 @@ error:
     return NULL;
 }
 
+struct wcore_window*
+wgbm_window_create(struct wcore_platform *wc_plat,
+                   struct wcore_config *wc_config,
+                   int width,
+                   int height)
+{
+    return wgbm_window_create_common(wc_config,
+                                     wgbm_window_get_gbm_format(wc_config),
+                                     width, height, NULL, 0);
+}
+
+/// @brief Query the modifiers that EGL can render to in @a gbm_format.
+///
+/// On success, the caller must free @a *modifiers.
+static bool
+wgbm_window_query_modifiers(struct wgbm_display *dpy,
+                            uint32_t gbm_format,
+                            uint64_t **modifiers,
+                            int32_t *num_modifiers)
+{
+    PFNEGLQUERYDMABUFMODIFIERSEXTPROC query = dpy->wegl.query_dmabuf_modifiers;
+    EGLuint64KHR *mods = NULL;
+    EGLBoolean *external_only = NULL;
+    EGLint n = 0;
+    int32_t num_renderable = 0;
+
+    if (!query) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL_EXT_image_dma_buf_import_modifiers is not "
+                     "supported");
+        return false;
+    }
+
+    if (!query(dpy->wegl.egl, gbm_format, 0, NULL, NULL, &n)) {
+        wegl_emit_error("eglQueryDmaBufModifiersEXT");
+        return false;
+    }
+
+    if (n > 0) {
+        mods = wcore_calloc(n * sizeof(*mods));
+        external_only = wcore_calloc(n * sizeof(*external_only));
+        if (!mods || !external_only)
+            goto fail;
+
+        if (!query(dpy->wegl.egl, gbm_format, n, mods, external_only, &n)) {
+            wegl_emit_error("eglQueryDmaBufModifiersEXT");
+            goto fail;
+        }
+    }
+
+    // External-only modifiers may be sampled but not rendered to.
+    for (EGLint i = 0; i < n; ++i) {
+        if (!external_only[i])
+            mods[num_renderable++] = mods[i];
+    }
+
+    if (num_renderable == 0) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "EGL supports no renderable modifiers for the "
+                     "config's format");
+        goto fail;
+    }
+
+    free(external_only);
+    *modifiers = mods;
+    *num_modifiers = num_renderable;
+    return true;
+
+fail:
+    free(mods);
+    free(external_only);
+    return false;
+}
+
+struct wcore_window*
+wgbm_window_create_with_modifiers(struct wcore_platform *wc_plat,
+                                  struct wcore_config *wc_config,
+                                  int width,
+                                  int height,
+                                  const uint64_t *modifiers,
+                                  int32_t num_modifiers)
+{
+    struct wgbm_display *dpy = wgbm_display(wc_config->display);
+    uint32_t gbm_format = wgbm_window_get_gbm_format(wc_config);
+    struct wcore_window *wc_self;
+    uint64_t *supported;
+    int32_t num_supported;
+
+    if (num_modifiers > 0) {
+        return wgbm_window_create_common(wc_config, gbm_format, width, height,
+                                         modifiers, num_modifiers);
+    }
+
+    // Query the format the surface will actually be created with.
+    if (!wgbm_window_query_modifiers(dpy, gbm_format,
+                                     &supported, &num_supported))
+        return NULL;
+
+    wc_self = wgbm_window_create_common(wc_config, gbm_format, width, height,
+                                        supported, num_supported);
+    free(supported);
+    return wc_self;
+}
+
 
 bool
 wgbm_window_show(struct wcore_window *wc_self)
@@ -100,6 +256,166 @@ wgbm_window_show(struct wcore_window *wc_self)
     return true;
 }
 
+/// @brief Lock the buffer posted by the last swap and pass it on.
+static bool
+wgbm_window_lock_front_buffer(struct wgbm_window *self)
+{
+    struct gbm_bo *bo = gbm_surface_lock_front_buffer(self->gbm_surface);
+    if (!bo) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "gbm_surface_lock_front_buffer failed");
+        return false;
+    }
+
+    self->posted_bo = bo;
+    self->modifier = gbm_bo_get_modifier(bo);
+
+    if (!self->front_buffer_func) {
+        if (self->front_bo)
+            gbm_surface_release_buffer(self->gbm_surface, self->front_bo);
+        self->front_bo = bo;
+        return true;
+    }
+
+    // Buffers kept from before the consumer was installed are no longer
+    // needed.
+    if (self->front_bo) {
+        gbm_surface_release_buffer(self->gbm_surface, self->front_bo);
+        self->front_bo = NULL;
+    }
+
+    assert(self->num_consumer_bos < WGBM_WINDOW_MAX_LOCKED_BOS);
+    self->consumer_bos[self->num_consumer_bos++] = bo;
+    self->front_buffer_func(&self->wegl.wcore.wfl, bo,
+                            self->front_buffer_user_data);
+    return true;
+}
+
+/// @brief Fail instead of letting EGL block or fail on an exhausted surface.
+static bool
+wgbm_window_check_free_buffers(struct wgbm_window *self)
+{
+    if (!gbm_surface_has_free_buffers(self->gbm_surface) ||
+        self->num_consumer_bos == WGBM_WINDOW_MAX_LOCKED_BOS) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "all buffers of the gbm_surface are held by the front "
+                     "buffer consumer; release some with "
+                     "waffle_window_release_front_buffer()");
+        return false;
+    }
+
+    return true;
+}
+
+bool
+wgbm_window_swap_buffers(struct wcore_window *wc_self)
+{
+    struct wgbm_window *self = wgbm_window(wc_self);
+
+    return wgbm_window_check_free_buffers(self)
+        && wegl_window_swap_buffers(wc_self)
+        && wgbm_window_lock_front_buffer(self);
+}
+
+bool
+wgbm_window_swap_buffers_with_damage(struct wcore_window *wc_self,
+                                     const int32_t *rects,
+                                     int32_t n_rects)
+{
+    struct wgbm_window *self = wgbm_window(wc_self);
+
+    return wgbm_window_check_free_buffers(self)
+        && wegl_window_swap_buffers_with_damage(wc_self, rects, n_rects)
+        && wgbm_window_lock_front_buffer(self);
+}
+
+bool
+wgbm_window_set_front_buffer_callback(
+        struct wcore_window *wc_self,
+        void (*func)(struct waffle_window *window,
+                     void *buffer,
+                     void *user_data),
+        void *user_data)
+{
+    struct wgbm_window *self = wgbm_window(wc_self);
+
+    self->front_buffer_func = func;
+    self->front_buffer_user_data = user_data;
+    return true;
+}
+
+bool
+wgbm_window_release_front_buffer(struct wcore_window *wc_self,
+                                 void *buffer)
+{
+    struct wgbm_window *self = wgbm_window(wc_self);
+
+    for (int i = 0; i < self->num_consumer_bos; ++i) {
+        if (self->consumer_bos[i] != buffer)
+            continue;
+
+        if (self->posted_bo == buffer)
+            self->posted_bo = NULL;
+
+        gbm_surface_release_buffer(self->gbm_surface, self->consumer_bos[i]);
+        memmove(&self->consumer_bos[i], &self->consumer_bos[i + 1],
+                (self->num_consumer_bos - i - 1) * sizeof(self->consumer_bos[0]));
+        self->num_consumer_bos--;
+        return true;
+    }
+
+    wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                 "buffer %p is not held by the front buffer consumer",
+                 buffer);
+    return false;
+}
+
+bool
+wgbm_window_export_dmabuf(struct wcore_window *wc_self,
+                          struct waffle_dmabuf *dmabuf)
+{
+    struct wgbm_window *self = wgbm_window(wc_self);
+    struct gbm_bo *bo = self->posted_bo;
+    int num_planes;
+
+    if (!bo) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "the window has no locked front buffer to export; "
+                     "swap first and do not release the buffer");
+        return false;
+    }
+
+    num_planes = gbm_bo_get_plane_count(bo);
+    if (num_planes <= 0 || num_planes > WAFFLE_DMABUF_MAX_PLANES) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "gbm_bo has unsupported plane count %d", num_planes);
+        return false;
+    }
+
+    memset(dmabuf, 0, sizeof(*dmabuf));
+    dmabuf->width = gbm_bo_get_width(bo);
+    dmabuf->height = gbm_bo_get_height(bo);
+    dmabuf->fourcc = gbm_bo_get_format(bo);
+    dmabuf->modifier = gbm_bo_get_modifier(bo);
+    dmabuf->num_planes = num_planes;
+
+    for (int i = 0; i < num_planes; ++i) {
+        // All planes of a gbm_bo live in one dma-buf.
+        dmabuf->fds[i] = gbm_bo_get_fd(bo);
+        if (dmabuf->fds[i] < 0) {
+            wcore_errorf(WAFFLE_ERROR_UNKNOWN, "gbm_bo_get_fd failed");
+            for (int j = 0; j < i; ++j)
+                close(dmabuf->fds[j]);
+            return false;
+        }
+
+        dmabuf->strides[i] = gbm_bo_get_stride_for_plane(bo, i);
+        dmabuf->offsets[i] = gbm_bo_get_offset(bo, i);
+    }
+
+    return true;
+}
+
 union waffle_native_window*
 wgbm_window_get_native(struct wcore_window *wc_self)
 {
@@ -114,6 +430,7 @@ wgbm_window_get_native(struct wcore_window *wc_self)
     wgbm_display_fill_native(dpy, &n_window->gbm->display);
     n_window->gbm->egl_surface = self->wegl.egl;
     n_window->gbm->gbm_surface = self->gbm_surface;
+    n_window->gbm->modifier = self->modifier;
 
     return n_window;
 }
@@ -29,10 +29,39 @@
 
 #include "wegl_window.h"
 
+struct gbm_bo;
+struct waffle_dmabuf;
+struct waffle_window;
 struct wcore_platform;
 
+/// Mesa's gbm_surface never has more than 4 color buffers.
+#define WGBM_WINDOW_MAX_LOCKED_BOS 4
+
 struct wgbm_window {
     struct gbm_surface *gbm_surface;
+
+    /// @brief The newest front buffer, when there is no consumer.
+    ///
+    /// Locking the front buffer after each swap, and releasing the previous
+    /// one, keeps the gbm_surface from running out of free buffers.
+    struct gbm_bo *front_bo;
+
+    /// @brief Front buffers handed to @a front_buffer_func and not yet
+    /// returned with wgbm_window_release_front_buffer().
+    struct gbm_bo *consumer_bos[WGBM_WINDOW_MAX_LOCKED_BOS];
+    int num_consumer_bos;
+
+    /// @brief The buffer posted by the last swap, while it is still locked.
+    struct gbm_bo *posted_bo;
+
+    /// @brief Modifier of the last posted buffer, or DRM_FORMAT_MOD_INVALID.
+    uint64_t modifier;
+
+    void (*front_buffer_func)(struct waffle_window *window,
+                              void *buffer,
+                              void *user_data);
+    void *front_buffer_user_data;
+
     struct wegl_window wegl;
 };
 
@@ -54,11 +83,43 @@ wgbm_window_create(struct wcore_platform *wc_plat,
                    int width,
                    int height);
 
+struct wcore_window*
+wgbm_window_create_with_modifiers(struct wcore_platform *wc_plat,
+                                  struct wcore_config *wc_config,
+                                  int width,
+                                  int height,
+                                  const uint64_t *modifiers,
+                                  int32_t num_modifiers);
+
 bool
 wgbm_window_destroy(struct wcore_window *wc_self);
 
 bool
 wgbm_window_show(struct wcore_window *wc_self);
 
+bool
+wgbm_window_swap_buffers(struct wcore_window *wc_self);
+
+bool
+wgbm_window_swap_buffers_with_damage(struct wcore_window *wc_self,
+                                     const int32_t *rects,
+                                     int32_t n_rects);
+
+bool
+wgbm_window_set_front_buffer_callback(
+        struct wcore_window *wc_self,
+        void (*func)(struct waffle_window *window,
+                     void *buffer,
+                     void *user_data),
+        void *user_data);
+
+bool
+wgbm_window_release_front_buffer(struct wcore_window *wc_self,
+                                 void *buffer);
+
+bool
+wgbm_window_export_dmabuf(struct wcore_window *wc_self,
+                          struct waffle_dmabuf *dmabuf);
+
 union waffle_native_window*
 wgbm_window_get_native(struct wcore_window *wc_self);
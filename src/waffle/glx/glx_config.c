@@ -29,6 +29,7 @@
 #include "linux_platform.h"
 
 #include "wcore_config_attrs.h"
+#include "wcore_config_rank.h"
 #include "wcore_error.h"
 
 #include "glx_config.h"
@@ -36,6 +37,13 @@
 #include "glx_platform.h"
 #include "glx_wrappers.h"
 
+/// @brief What glx_config_choose() stores in the display's config cache.
+struct glx_config_cached {
+    GLXFBConfig glx_fbconfig;
+    int32_t glx_fbconfig_id;
+    xcb_visualid_t xcb_visual_id;
+};
+
 bool
 glx_config_destroy(struct wcore_config *wc_self)
 {
@@ -49,6 +57,116 @@ glx_config_destroy(struct wcore_config *wc_self)
     return ok;
 }
 
+#ifndef GLX_RGBA_FLOAT_BIT_ARB
+#define GLX_RGBA_FLOAT_BIT_ARB 0x00000004
+#endif
+
+/// @brief Map a waffle attribute that names a buffer size to GLX.
+static int
+glx_size_attrib(int32_t waffle_attrib)
+{
+    switch (waffle_attrib) {
+        case WAFFLE_RED_SIZE:       return GLX_RED_SIZE;
+        case WAFFLE_GREEN_SIZE:     return GLX_GREEN_SIZE;
+        case WAFFLE_BLUE_SIZE:      return GLX_BLUE_SIZE;
+        case WAFFLE_ALPHA_SIZE:     return GLX_ALPHA_SIZE;
+        case WAFFLE_DEPTH_SIZE:     return GLX_DEPTH_SIZE;
+        case WAFFLE_STENCIL_SIZE:   return GLX_STENCIL_SIZE;
+        case WAFFLE_SAMPLE_BUFFERS: return GLX_SAMPLE_BUFFERS;
+        case WAFFLE_SAMPLES:        return GLX_SAMPLES;
+        default:                    return 0;
+    }
+}
+
+static bool
+glx_config_get_sizes(struct glx_display *dpy, GLXFBConfig config,
+                     struct wcore_config_sizes *sizes)
+{
+    int values[8];
+    const int attribs[8] = {
+        GLX_RED_SIZE, GLX_GREEN_SIZE, GLX_BLUE_SIZE, GLX_ALPHA_SIZE,
+        GLX_DEPTH_SIZE, GLX_STENCIL_SIZE, GLX_SAMPLES, GLX_CONFIG_CAVEAT,
+    };
+
+    for (int i = 0; i < 8; i++) {
+        if (wrapped_glXGetFBConfigAttrib(dpy->x11.xlib, config, attribs[i],
+                                         &values[i]))
+            return false;
+    }
+
+    sizes->red_size = values[0];
+    sizes->green_size = values[1];
+    sizes->blue_size = values[2];
+    sizes->alpha_size = values[3];
+    sizes->depth_size = values[4];
+    sizes->stencil_size = values[5];
+    sizes->samples = values[6];
+
+    switch (values[7]) {
+        case GLX_SLOW_CONFIG:
+            sizes->caveat = WCORE_CONFIG_CAVEAT_SLOW;
+            break;
+        case GLX_NON_CONFORMANT_CONFIG:
+            sizes->caveat = WCORE_CONFIG_CAVEAT_NON_CONFORMANT;
+            break;
+        default:
+            sizes->caveat = WCORE_CONFIG_CAVEAT_NONE;
+            break;
+    }
+
+    return true;
+}
+
+/// @brief Choose among the configs returned by glXChooseFBConfig.
+///
+/// glXChooseFBConfig treats the sizes as minimums and sorts deeper configs
+/// first, so an explicit color format must be matched here, and
+/// WAFFLE_CONFIG_SELECTION_SMALLEST ranks the candidates by footprint.
+/// Compacts @a configs in place.
+static GLXFBConfig
+glx_config_choose_from_list(struct glx_display *dpy,
+                            const struct wcore_config_attrs *attrs,
+                            GLXFBConfig *configs, int num_configs)
+{
+    struct wcore_config_sizes *sizes;
+    GLXFBConfig config = NULL;
+    int num_candidates = 0;
+    int best = 0;
+
+    if (attrs->color_format == WAFFLE_DONT_CARE &&
+        attrs->config_selection != WAFFLE_CONFIG_SELECTION_SMALLEST)
+        return configs[0];
+
+    sizes = wcore_calloc(num_configs * sizeof(*sizes));
+    if (!sizes)
+        return NULL;
+
+    for (int i = 0; i < num_configs; i++) {
+        struct wcore_config_sizes *s = &sizes[num_candidates];
+
+        if (!glx_config_get_sizes(dpy, configs[i], s))
+            continue;
+
+        if (attrs->color_format != WAFFLE_DONT_CARE &&
+            (s->red_size != attrs->red_size ||
+             s->green_size != attrs->green_size ||
+             s->blue_size != attrs->blue_size ||
+             s->alpha_size != attrs->alpha_size))
+            continue;
+
+        configs[num_candidates++] = configs[i];
+    }
+
+    if (num_candidates > 0) {
+        if (attrs->config_selection == WAFFLE_CONFIG_SELECTION_SMALLEST)
+            best = wcore_config_rank_smallest(sizes, num_candidates);
+        config = configs[best];
+    }
+
+    free(sizes);
+    return config;
+}
+
 /// @brief Check the values of `attrs->context_*`.
 static bool
 glx_config_check_context_attrs(struct glx_display *dpy,
@@ -68,6 +186,39 @@ glx_config_check_context_attrs(struct glx_display *dpy,
         return false;
     }
 
+    if (attrs->context_no_error && !dpy->ARB_create_context_no_error) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "GLX_ARB_create_context_no_error is required in order to "
+                     "request a no-error context");
+        return false;
+    }
+
+    if (attrs->context_release_behavior == WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE &&
+        !dpy->ARB_context_flush_control) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "GLX_ARB_context_flush_control is required in order to "
+                     "request WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE");
+        return false;
+    }
+
+    if (attrs->context_priority != WAFFLE_DONT_CARE) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "GLX does not support context priorities");
+        return false;
+    }
+
+    if (attrs->mutable_render_buffer) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "GLX does not support mutable render buffers");
+        return false;
+    }
+
+    if (attrs->context_no_config) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "GLX does not support contexts without a config");
+        return false;
+    }
+
     switch (attrs->context_api) {
         case WAFFLE_CONTEXT_OPENGL:
             if (attrs->context_full_version != 10 && !dpy->ARB_create_context) {
@@ -168,14 +319,20 @@ glx_config_choose(struct wcore_platform *wc_plat,
 {
     struct glx_config *self;
     struct glx_display *dpy = glx_display(wc_dpy);
+    struct glx_config_cached cached;
 
     GLXFBConfig *configs = NULL;
     int num_configs = 0;
     XVisualInfo *vi = NULL;
 
     bool ok = true;
+    bool hit;
 
-    if (!glx_config_check_context_attrs(dpy, attrs))
+    // The cache holds only configs that passed the context checks.
+    hit = wcore_config_cache_lookup(&wc_dpy->config_cache, attrs,
+                                    &cached, sizeof(cached));
+
+    if (!hit && !glx_config_check_context_attrs(dpy, attrs))
         return NULL;
 
     self = wcore_calloc(sizeof(*self));
@@ -186,6 +343,21 @@ glx_config_choose(struct wcore_platform *wc_plat,
     if (!ok)
         goto error;
 
+    if (hit) {
+        self->glx_fbconfig = cached.glx_fbconfig;
+        self->glx_fbconfig_id = cached.glx_fbconfig_id;
+        self->xcb_visual_id = cached.xcb_visual_id;
+        return &self->wcore;
+    }
+
+    if (attrs->color_format == WAFFLE_COLOR_FORMAT_RGBA16F &&
+        !dpy->ARB_fbconfig_float) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "GLX_ARB_fbconfig_float is required in order to "
+                     "request WAFFLE_COLOR_FORMAT_RGBA16F");
+        goto error;
+    }
+
     int attrib_list[] = {
         // From page 12 (18 of pdf) of the GLX 1.4 spec:
         //
@@ -216,6 +388,10 @@ glx_config_choose(struct wcore_platform *wc_plat,
         // here for the sake of self-documentation.
         GLX_DRAWABLE_TYPE,      GLX_WINDOW_BIT,
 
+        GLX_RENDER_TYPE,        attrs->color_format == WAFFLE_COLOR_FORMAT_RGBA16F
+                                    ? GLX_RGBA_FLOAT_BIT_ARB
+                                    : GLX_RGBA_BIT,
+
         0,
     };
 
@@ -229,8 +405,21 @@ glx_config_choose(struct wcore_platform *wc_plat,
                      "glXChooseFBConfig returned no matching configs");
         goto error;
     }
-    // Simply take the first.
-    self->glx_fbconfig = configs[0];
+
+    self->glx_fbconfig = glx_config_choose_from_list(dpy, attrs,
+                                                     configs, num_configs);
+    if (!self->glx_fbconfig) {
+        if (attrs->color_format != WAFFLE_DONT_CARE) {
+            wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                         "no GLXFBConfig has the exact channel sizes of "
+                         "the requested color format");
+        }
+        else {
+            wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                         "glXGetFBConfigAttrib failed for every config");
+        }
+        goto error;
+    }
 
     // Set glx_fbconfig_id.
     ok = !wrapped_glXGetFBConfigAttrib(dpy->x11.xlib,
@@ -253,6 +442,13 @@ glx_config_choose(struct wcore_platform *wc_plat,
     }
     self->xcb_visual_id = vi->visualid;
 
+    memset(&cached, 0, sizeof(cached));
+    cached.glx_fbconfig = self->glx_fbconfig;
+    cached.glx_fbconfig_id = self->glx_fbconfig_id;
+    cached.xcb_visual_id = self->xcb_visual_id;
+    wcore_config_cache_insert(&wc_dpy->config_cache, attrs,
+                              &cached, sizeof(cached));
+
     goto cleanup;
 
 error:
@@ -284,3 +480,22 @@ glx_config_get_native(struct wcore_config *wc_self)
 
     return n_config;
 }
+
+bool
+glx_config_get_attrib(struct wcore_config *wc_self,
+                      int32_t attrib,
+                      int32_t *value)
+{
+    struct glx_config *self = glx_config(wc_self);
+    struct glx_display *dpy = glx_display(wc_self->display);
+    int glx_value;
+
+    if (wrapped_glXGetFBConfigAttrib(dpy->x11.xlib, self->glx_fbconfig,
+                                     glx_size_attrib(attrib), &glx_value)) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "glXGetFBConfigAttrib failed");
+        return false;
+    }
+
+    *value = glx_value;
+    return true;
+}
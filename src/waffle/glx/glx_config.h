@@ -60,3 +60,8 @@ glx_config_destroy(struct wcore_config *wc_self);
 
 union waffle_native_config*
 glx_config_get_native(struct wcore_config *wc_self);
+
+bool
+glx_config_get_attrib(struct wcore_config *wc_self,
+                      int32_t attrib,
+                      int32_t *value);
@@ -29,6 +29,16 @@
 // It is an alias of GLX_CONTEXT_ES2_PROFILE_BIT_EXT.
 #define GLX_CONTEXT_ES_PROFILE_BIT_EXT 0x00000004
 
+#ifndef GLX_CONTEXT_OPENGL_NO_ERROR_ARB
+#define GLX_CONTEXT_OPENGL_NO_ERROR_ARB 0x31B3
+#endif
+
+#ifndef GLX_ARB_context_flush_control
+#define GLX_CONTEXT_RELEASE_BEHAVIOR_ARB 0x2097
+#define GLX_CONTEXT_RELEASE_BEHAVIOR_NONE_ARB 0
+#define GLX_CONTEXT_RELEASE_BEHAVIOR_FLUSH_ARB 0x2098
+#endif
+
 #include <assert.h>
 #include <stdlib.h>
 
@@ -149,6 +159,26 @@ glx_context_fill_attrib_list(struct glx_config *config,
         attrib_list[i++] = context_flags;
     }
 
+    if (attrs->context_no_error) {
+        attrib_list[i++] = GLX_CONTEXT_OPENGL_NO_ERROR_ARB;
+        attrib_list[i++] = true;
+    }
+
+    // Without the extension, every context flushes on release, which is
+    // what WAFFLE_CONTEXT_RELEASE_BEHAVIOR_FLUSH asks for.
+    if (dpy->ARB_context_flush_control) {
+        switch (attrs->context_release_behavior) {
+            case WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE:
+                attrib_list[i++] = GLX_CONTEXT_RELEASE_BEHAVIOR_ARB;
+                attrib_list[i++] = GLX_CONTEXT_RELEASE_BEHAVIOR_NONE_ARB;
+                break;
+            case WAFFLE_CONTEXT_RELEASE_BEHAVIOR_FLUSH:
+                attrib_list[i++] = GLX_CONTEXT_RELEASE_BEHAVIOR_ARB;
+                attrib_list[i++] = GLX_CONTEXT_RELEASE_BEHAVIOR_FLUSH_ARB;
+                break;
+        }
+    }
+
     attrib_list[i++] = 0;
     return true;
 }
@@ -207,6 +237,7 @@ glx_context_create(struct wcore_platform *wc_plat,
     struct glx_context *self;
     struct glx_config *config = glx_config(wc_config);
     struct glx_context *share_ctx = glx_context(wc_share_ctx);
+    struct glx_display *dpy = glx_display(wc_config->display);
     bool ok = true;
 
     self = wcore_calloc(sizeof(*self));
@@ -221,6 +252,11 @@ glx_context_create(struct wcore_platform *wc_plat,
     if (!self->glx)
         goto error;
 
+    if (share_ctx)
+        self->share_group = share_ctx->share_group;
+    else
+        self->share_group = ++dpy->num_share_groups;
+
     return &self->wcore;
 
 error:
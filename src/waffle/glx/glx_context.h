@@ -26,6 +26,7 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #include <GL/glx.h>
 
@@ -38,6 +39,10 @@ struct wcore_platform;
 struct glx_context {
     struct wcore_context wcore;
     GLXContext glx;
+
+    /// @brief Nonzero number of the context's share group, unique within
+    /// its display. A context created with a share context inherits it.
+    uint64_t share_group;
 };
 
 DEFINE_CONTAINER_CAST_FUNC(glx_context,
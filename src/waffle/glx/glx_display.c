@@ -62,6 +62,8 @@ glx_display_set_extensions(struct glx_display *self)
 
     self->ARB_create_context                     = waffle_is_extension_in_string(s, "GLX_ARB_create_context");
     self->ARB_create_context_profile             = waffle_is_extension_in_string(s, "GLX_ARB_create_context_profile");
+    self->ARB_create_context_no_error            = waffle_is_extension_in_string(s, "GLX_ARB_create_context_no_error");
+    self->ARB_context_flush_control              = waffle_is_extension_in_string(s, "GLX_ARB_context_flush_control");
     self->EXT_create_context_es_profile          = waffle_is_extension_in_string(s, "GLX_EXT_create_context_es_profile");
 
     // The GLX_EXT_create_context_es2_profile spec, version 4 2012/03/28,
@@ -78,6 +80,12 @@ glx_display_set_extensions(struct glx_display *self)
         self->EXT_create_context_es2_profile = waffle_is_extension_in_string(s, "GLX_EXT_create_context_es2_profile");
     }
 
+    self->ARB_fbconfig_float                     = waffle_is_extension_in_string(s, "GLX_ARB_fbconfig_float");
+    self->EXT_buffer_age                         = waffle_is_extension_in_string(s, "GLX_EXT_buffer_age");
+    self->EXT_swap_control                       = waffle_is_extension_in_string(s, "GLX_EXT_swap_control");
+    self->EXT_swap_control_tear                  = waffle_is_extension_in_string(s, "GLX_EXT_swap_control_tear");
+    self->MESA_swap_control                      = waffle_is_extension_in_string(s, "GLX_MESA_swap_control");
+
     return true;
 }
 
@@ -46,8 +46,19 @@ struct glx_display {
 
     bool ARB_create_context;
     bool ARB_create_context_profile;
+    bool ARB_create_context_no_error;
+    bool ARB_context_flush_control;
     bool EXT_create_context_es_profile;
     bool EXT_create_context_es2_profile;
+    bool ARB_fbconfig_float;
+    bool EXT_buffer_age;
+    bool EXT_swap_control;
+    bool EXT_swap_control_tear;
+    bool MESA_swap_control;
+
+    /// @brief Number of share groups created on the display. Used to number
+    /// them.
+    uint64_t num_share_groups;
 };
 
 DEFINE_CONTAINER_CAST_FUNC(glx_display,
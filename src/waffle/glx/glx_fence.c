@@ -0,0 +1,158 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "wcore_error.h"
+#include "wcore_tinfo.h"
+
+#include "glx_context.h"
+#include "glx_fence.h"
+#include "glx_platform.h"
+
+/// @brief Check that the current context provides GL_ARB_sync.
+static bool
+glx_fence_check_support(struct glx_platform *plat)
+{
+    const char *version = NULL;
+    const char *extensions;
+    int major = 0, minor = 0;
+
+    if (plat->glGetString)
+        version = (const char*) plat->glGetString(GL_VERSION);
+
+    if (!plat->glFenceSync || !plat->glClientWaitSync ||
+        !plat->glDeleteSync || !version) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "GL_ARB_sync is not supported");
+        return false;
+    }
+
+    // The extension is core in OpenGL 3.2, whose core profile cannot list
+    // extensions with glGetString.
+    if (sscanf(version, "%d.%d", &major, &minor) == 2 &&
+        major * 10 + minor >= 32)
+        return true;
+
+    extensions = (const char*) plat->glGetString(GL_EXTENSIONS);
+    if (!extensions ||
+        !waffle_is_extension_in_string(extensions, "GL_ARB_sync")) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "GL_ARB_sync is not supported");
+        return false;
+    }
+
+    return true;
+}
+
+/// @brief Check that a context in the fence's share group is current.
+static bool
+glx_fence_is_current(struct glx_fence *self)
+{
+    struct wcore_context *ctx = wcore_tinfo_get()->current.context;
+
+    return ctx &&
+           ctx->display == self->wcore.display &&
+           glx_context(ctx)->share_group == self->share_group;
+}
+
+struct wcore_fence*
+glx_fence_create(struct wcore_platform *wc_plat,
+                 struct wcore_context *wc_ctx)
+{
+    struct glx_platform *plat = glx_platform(wc_plat);
+    struct glx_fence *self;
+    bool ok;
+
+    if (!glx_fence_check_support(plat))
+        return NULL;
+
+    self = wcore_calloc(sizeof(*self));
+    if (!self)
+        return NULL;
+
+    ok = wcore_fence_init(&self->wcore, wc_ctx);
+    if (!ok)
+        goto error;
+
+    self->platform = plat;
+    self->share_group = glx_context(wc_ctx)->share_group;
+    self->sync = plat->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    if (!self->sync) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "glFenceSync failed");
+        goto error;
+    }
+
+    // Flush the fence, so that a wait from another context terminates.
+    plat->glClientWaitSync(self->sync, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    return &self->wcore;
+
+error:
+    free(self);
+    return NULL;
+}
+
+bool
+glx_fence_destroy(struct wcore_fence *wc_self)
+{
+    struct glx_fence *self = glx_fence(wc_self);
+    bool ok;
+
+    // The sync name means nothing outside its share group. Without a
+    // current context in the group, it is released with the group.
+    if (glx_fence_is_current(self))
+        self->platform->glDeleteSync(self->sync);
+
+    ok = wcore_fence_teardown(&self->wcore);
+    free(self);
+    return ok;
+}
+
+bool
+glx_fence_wait(struct wcore_fence *wc_self,
+               uint64_t timeout_ns,
+               bool *signaled)
+{
+    struct glx_fence *self = glx_fence(wc_self);
+    GLenum status;
+
+    if (!glx_fence_is_current(self)) {
+        wcore_errorf(WAFFLE_ERROR_BAD_PARAMETER,
+                     "waiting on a GLX fence requires a current context in "
+                     "its share group");
+        return false;
+    }
+
+    status = self->platform->glClientWaitSync(self->sync, 0, timeout_ns);
+    if (status == GL_WAIT_FAILED) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN, "glClientWaitSync failed");
+        return false;
+    }
+
+    *signaled = status == GL_ALREADY_SIGNALED ||
+                status == GL_CONDITION_SATISFIED;
+    return true;
+}
@@ -32,6 +32,7 @@
 #include "glx_config.h"
 #include "glx_context.h"
 #include "glx_display.h"
+#include "glx_fence.h"
 #include "glx_platform.h"
 #include "glx_window.h"
 #include "glx_wrappers.h"
@@ -74,6 +75,13 @@ glx_platform_create(void)
         goto error;
 
     self->glXCreateContextAttribsARB = (PFNGLXCREATECONTEXTATTRIBSARBPROC) glXGetProcAddress((const uint8_t*) "glXCreateContextAttribsARB");
+    self->glXSwapIntervalEXT = (PFNGLXSWAPINTERVALEXTPROC) glXGetProcAddress((const uint8_t*) "glXSwapIntervalEXT");
+    self->glXSwapIntervalMESA = (PFNGLXSWAPINTERVALMESAPROC) glXGetProcAddress((const uint8_t*) "glXSwapIntervalMESA");
+
+    self->glFenceSync = (PFNGLFENCESYNCPROC) glXGetProcAddress((const uint8_t*) "glFenceSync");
+    self->glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC) glXGetProcAddress((const uint8_t*) "glClientWaitSync");
+    self->glDeleteSync = (PFNGLDELETESYNCPROC) glXGetProcAddress((const uint8_t*) "glDeleteSync");
+    self->glGetString = (const GLubyte *(*)(GLenum)) glXGetProcAddress((const uint8_t*) "glGetString");
 
     self->wcore.vtbl = &glx_platform_vtbl;
     return &self->wcore;
@@ -89,16 +97,36 @@ glx_platform_make_current(struct wcore_platform *wc_self,
                           struct wcore_window *wc_window,
                           struct wcore_context *wc_ctx)
 {
-    return wrapped_glXMakeCurrent(glx_display(wc_dpy)->x11.xlib,
-                                  wc_window ? glx_window(wc_window)->x11.xcb : 0,
-                                  wc_ctx ? glx_context(wc_ctx)->glx : NULL);
+    bool ok = wrapped_glXMakeCurrent(glx_display(wc_dpy)->x11.xlib,
+                                     wc_window ? glx_window(wc_window)->x11.xcb : 0,
+                                     wc_ctx ? glx_context(wc_ctx)->glx : NULL);
+    if (!ok)
+        return false;
+
+    // As on EGL, a deferred swap interval is best-effort.
+    if (wc_window) {
+        WCORE_ERROR_DISABLED({
+            glx_window_apply_swap_interval(glx_window(wc_window));
+        });
+    }
+
+    return true;
+}
+
+static void*
+glx_platform_get_proc_address_uncached(struct wcore_platform *wc_self,
+                                       const char *name)
+{
+    return glXGetProcAddress((const GLubyte*) name);
 }
 
 static void*
 glx_platform_get_proc_address(struct wcore_platform *wc_self,
                               const char *name)
 {
-    return glXGetProcAddress((const GLubyte*) name);
+    return linux_platform_get_proc_address(
+                glx_platform(wc_self)->linux, wc_self,
+                glx_platform_get_proc_address_uncached, name);
 }
 
 static bool
@@ -119,6 +147,24 @@ glx_platform_dl_sym(struct wcore_platform *wc_self,
                                               name);
 }
 
+static void
+glx_platform_dl_sym_array(struct wcore_platform *wc_self,
+                          int32_t waffle_dl,
+                          int32_t count,
+                          const char *const names[],
+                          void *syms[])
+{
+    linux_platform_dl_sym_array(glx_platform(wc_self)->linux,
+                                waffle_dl, count, names, syms);
+}
+
+static void
+glx_platform_get_symbol_cache_stats(struct wcore_platform *wc_self,
+                                    struct waffle_symbol_cache_stats *stats)
+{
+    linux_platform_get_symbol_cache_stats(glx_platform(wc_self)->linux, stats);
+}
+
 static const struct wcore_platform_vtbl glx_platform_vtbl = {
     .destroy = glx_platform_destroy,
 
@@ -126,6 +172,8 @@ static const struct wcore_platform_vtbl glx_platform_vtbl = {
     .get_proc_address = glx_platform_get_proc_address,
     .dl_can_open = glx_platform_dl_can_open,
     .dl_sym = glx_platform_dl_sym,
+    .dl_sym_array = glx_platform_dl_sym_array,
+    .get_symbol_cache_stats = glx_platform_get_symbol_cache_stats,
 
     .display = {
         .connect = glx_display_connect,
@@ -138,6 +186,7 @@ static const struct wcore_platform_vtbl glx_platform_vtbl = {
         .choose = glx_config_choose,
         .destroy = glx_config_destroy,
         .get_native = glx_config_get_native,
+        .get_attrib = glx_config_get_attrib,
     },
 
     .context = {
@@ -151,7 +200,15 @@ static const struct wcore_platform_vtbl glx_platform_vtbl = {
         .destroy = glx_window_destroy,
         .show = glx_window_show,
         .resize = glx_window_resize,
+        .get_buffer_age = glx_window_get_buffer_age,
+        .set_swap_interval = glx_window_set_swap_interval,
         .swap_buffers = glx_window_swap_buffers,
         .get_native = glx_window_get_native,
     },
+
+    .fence = {
+        .create = glx_fence_create,
+        .destroy = glx_fence_destroy,
+        .wait = glx_fence_wait,
+    },
 };
@@ -42,6 +42,17 @@ struct glx_platform {
     struct linux_platform *linux;
 
     PFNGLXCREATECONTEXTATTRIBSARBPROC glXCreateContextAttribsARB;
+    PFNGLXSWAPINTERVALEXTPROC glXSwapIntervalEXT;
+    PFNGLXSWAPINTERVALMESAPROC glXSwapIntervalMESA;
+
+    /// @brief GL_ARB_sync, for fences.
+    ///
+    /// glXGetProcAddress returns these even if the current context lacks
+    /// the extension, so check the context before using them.
+    PFNGLFENCESYNCPROC glFenceSync;
+    PFNGLCLIENTWAITSYNCPROC glClientWaitSync;
+    PFNGLDELETESYNCPROC glDeleteSync;
+    const GLubyte *(*glGetString)(GLenum name);
 };
 
 DEFINE_CONTAINER_CAST_FUNC(glx_platform,
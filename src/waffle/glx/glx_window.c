@@ -30,9 +30,14 @@
 
 #include "glx_config.h"
 #include "glx_display.h"
+#include "glx_platform.h"
 #include "glx_window.h"
 #include "glx_wrappers.h"
 
+#ifndef GLX_BACK_BUFFER_AGE_EXT
+#define GLX_BACK_BUFFER_AGE_EXT 0x20F4
+#endif
+
 bool
 glx_window_destroy(struct wcore_window *wc_self)
 {
@@ -95,6 +100,89 @@ glx_window_resize(struct wcore_window *wc_self,
     return x11_window_resize(&glx_window(wc_self)->x11, width, height);
 }
 
+bool
+glx_window_get_buffer_age(struct wcore_window *wc_self, int32_t *age)
+{
+    struct glx_window *self = glx_window(wc_self);
+    struct glx_display *dpy = glx_display(wc_self->display);
+    unsigned int value = 0;
+
+    if (!dpy->EXT_buffer_age) {
+        wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                     "GLX_EXT_buffer_age is not supported");
+        return false;
+    }
+
+    wrapped_glXQueryDrawable(dpy->x11.xlib, self->x11.xcb,
+                             GLX_BACK_BUFFER_AGE_EXT, &value);
+    *age = value;
+    return true;
+}
+
+bool
+glx_window_set_swap_interval(struct wcore_window *wc_self,
+                             int32_t interval)
+{
+    struct glx_window *self = glx_window(wc_self);
+    struct glx_display *dpy = glx_display(wc_self->display);
+    struct glx_platform *plat = glx_platform(wc_self->display->platform);
+
+    if (dpy->EXT_swap_control && plat->glXSwapIntervalEXT) {
+        if (interval < 0 && !dpy->EXT_swap_control_tear) {
+            wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                         "adaptive vsync requires GLX_EXT_swap_control_tear");
+            return false;
+        }
+
+        // GLX_EXT_swap_control is per drawable; no need to be current.
+        plat->glXSwapIntervalEXT(dpy->x11.xlib, self->x11.xcb, interval);
+        return true;
+    }
+
+    if (dpy->MESA_swap_control && plat->glXSwapIntervalMESA) {
+        if (interval < 0) {
+            wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                         "adaptive vsync requires GLX_EXT_swap_control_tear");
+            return false;
+        }
+
+        self->swap_interval = interval;
+        self->swap_interval_pending = true;
+
+        if (glXGetCurrentDrawable() == self->x11.xcb)
+            return glx_window_apply_swap_interval(self);
+
+        return true;
+    }
+
+    wcore_errorf(WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM,
+                 "GLX_EXT_swap_control and GLX_MESA_swap_control are not "
+                 "supported");
+    return false;
+}
+
+bool
+glx_window_apply_swap_interval(struct glx_window *self)
+{
+    struct glx_platform *plat = glx_platform(self->wcore.display->platform);
+    int error;
+
+    if (!self->swap_interval_pending)
+        return true;
+
+    self->swap_interval_pending = false;
+
+    error = plat->glXSwapIntervalMESA(self->swap_interval);
+    if (error) {
+        wcore_errorf(WAFFLE_ERROR_UNKNOWN,
+                     "glXSwapIntervalMESA(%d) failed with error %d",
+                     self->swap_interval, error);
+        return false;
+    }
+
+    return true;
+}
+
 bool
 glx_window_swap_buffers(struct wcore_window *wc_self)
 {
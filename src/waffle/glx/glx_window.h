@@ -39,6 +39,12 @@ struct wcore_platform;
 struct glx_window {
     struct wcore_window wcore;
     struct x11_window x11;
+
+    /// GLX_MESA_swap_control only affects the current drawable, so an
+    /// interval requested while the window is not current is stored here
+    /// and applied by the next make current.
+    int32_t swap_interval;
+    bool swap_interval_pending;
 };
 
 DEFINE_CONTAINER_CAST_FUNC(glx_window,
@@ -61,6 +67,19 @@ bool
 glx_window_resize(struct wcore_window *wc_self,
                   int32_t width, int32_t height);
 
+bool
+glx_window_get_buffer_age(struct wcore_window *wc_self, int32_t *age);
+
+bool
+glx_window_set_swap_interval(struct wcore_window *wc_self,
+                             int32_t interval);
+
+/// @brief Apply a pending swap interval. The window must be current.
+///
+/// The interval is no longer pending afterwards, even on failure.
+bool
+glx_window_apply_swap_interval(struct glx_window *self);
+
 bool
 glx_window_swap_buffers(struct wcore_window *wc_self);
 
@@ -113,6 +113,15 @@ wrapped_glXMakeCurrent(Display *dpy, GLXDrawable drawable, GLXContext ctx)
     return ok;
 }
 
+static inline void
+wrapped_glXQueryDrawable(Display *dpy, GLXDrawable draw, int attribute,
+                         unsigned int *value)
+{
+    X11_SAVE_ERROR_HANDLER
+    glXQueryDrawable(dpy, draw, attribute, value);
+    X11_RESTORE_ERROR_HANDLER
+}
+
 static inline const char*
 wrapped_glXQueryExtensionsString(Display *dpy, int screen)
 {
@@ -31,21 +31,39 @@
 #include <stdlib.h>
 
 #include "wcore_error.h"
+#include "wcore_symbol_cache.h"
 #include "wcore_util.h"
 
 #include "linux_dl.h"
 #include "linux_platform.h"
 
+enum {
+    /// @brief Symbol cache key for get_proc_address. It differs from every
+    /// `WAFFLE_DL_*`.
+    LINUX_PLATFORM_PROC_ADDRESS_KEY = 0,
+};
+
 struct linux_platform {
     struct linux_dl *libgl;
     struct linux_dl *libgles1;
     struct linux_dl *libgles2;
+
+    /// @brief Resolved symbols, keyed by `WAFFLE_DL_*` for dl_sym and by
+    /// LINUX_PLATFORM_PROC_ADDRESS_KEY for get_proc_address.
+    struct wcore_symbol_cache symbols;
 };
 
 struct linux_platform*
 linux_platform_create(void)
 {
-    return wcore_calloc(sizeof(struct linux_platform));
+    struct linux_platform *self;
+
+    self = wcore_calloc(sizeof(*self));
+    if (!self)
+        return NULL;
+
+    wcore_symbol_cache_init(&self->symbols);
+    return self;
 }
 
 bool
@@ -61,6 +79,9 @@ linux_platform_destroy(struct linux_platform *self)
     ok &= linux_dl_close(self->libgles1);
     ok &= linux_dl_close(self->libgles2);
 
+    wcore_symbol_cache_teardown(&self->symbols);
+    free(self);
+
     return ok;
 }
 
@@ -105,11 +126,81 @@ linux_platform_dl_sym(
         int32_t waffle_dl,
         const char *name)
 {
-    struct linux_dl *dl = linux_platform_get_dl(self, waffle_dl);
+    struct linux_dl *dl;
+    void *sym;
+
+    sym = wcore_symbol_cache_lookup(&self->symbols, waffle_dl, name);
+    if (sym)
+        return sym;
+
+    dl = linux_platform_get_dl(self, waffle_dl);
     if (!dl)
         return NULL;
 
-    return linux_dl_sym(dl, name);
+    sym = linux_dl_sym(dl, name);
+    wcore_symbol_cache_insert(&self->symbols, waffle_dl, name, sym);
+    return sym;
+}
+
+void
+linux_platform_dl_sym_array(
+        struct linux_platform *self,
+        int32_t waffle_dl,
+        int32_t count,
+        const char *const names[],
+        void *syms[])
+{
+    struct linux_dl *dl;
+    int32_t num_misses;
+
+    num_misses = wcore_symbol_cache_lookup_array(&self->symbols, waffle_dl,
+                                                 count, names, syms);
+    if (num_misses == 0)
+        return;
+
+    dl = linux_platform_get_dl(self, waffle_dl);
+    if (!dl)
+        return;
+
+    for (int32_t i = 0; i < count; ++i) {
+        if (syms[i])
+            continue;
+
+        syms[i] = linux_dl_sym(dl, names[i]);
+        wcore_symbol_cache_insert(&self->symbols, waffle_dl, names[i],
+                                  syms[i]);
+    }
+}
+
+void*
+linux_platform_get_proc_address(
+        struct linux_platform *self,
+        struct wcore_platform *wc_plat,
+        void* (*get_proc_address)(struct wcore_platform *wc_plat,
+                                  const char *name),
+        const char *name)
+{
+    void *proc;
+
+    proc = wcore_symbol_cache_lookup(&self->symbols,
+                                     LINUX_PLATFORM_PROC_ADDRESS_KEY,
+                                     name);
+    if (proc)
+        return proc;
+
+    proc = get_proc_address(wc_plat, name);
+    wcore_symbol_cache_insert(&self->symbols,
+                              LINUX_PLATFORM_PROC_ADDRESS_KEY,
+                              name, proc);
+    return proc;
+}
+
+void
+linux_platform_get_symbol_cache_stats(
+        struct linux_platform *self,
+        struct waffle_symbol_cache_stats *stats)
+{
+    wcore_symbol_cache_get_stats(&self->symbols, stats);
 }
 
 /// @}
@@ -35,6 +35,8 @@
 #include <stdint.h>
 
 struct linux_platform;
+struct waffle_symbol_cache_stats;
+struct wcore_platform;
 
 struct linux_platform*
 linux_platform_create(void);
@@ -48,10 +50,38 @@ linux_platform_dl_can_open(
         struct linux_platform *self,
         int32_t waffle_dl);
 
+/// @brief Like linux_dl_sym(), but cached.
 void*
 linux_platform_dl_sym(
         struct linux_platform *self,
         int32_t waffle_dl,
         const char *name);
 
+/// @brief Like linux_platform_dl_sym() for each of @a count symbols, but
+/// the library is looked up and the cache is locked only once.
+void
+linux_platform_dl_sym_array(
+        struct linux_platform *self,
+        int32_t waffle_dl,
+        int32_t count,
+        const char *const names[],
+        void *syms[]);
+
+/// @brief Cache the results of a platform's get_proc_address function.
+///
+/// On a cache miss, call @a get_proc_address with @a wc_plat and @a name.
+void*
+linux_platform_get_proc_address(
+        struct linux_platform *self,
+        struct wcore_platform *wc_plat,
+        void* (*get_proc_address)(struct wcore_platform *wc_plat,
+                                  const char *name),
+        const char *name);
+
+/// @copydoc waffle_get_symbol_cache_stats()
+void
+linux_platform_get_symbol_cache_stats(
+        struct linux_platform *self,
+        struct waffle_symbol_cache_stats *stats);
+
 /// @}
@@ -0,0 +1,218 @@
+// Copyright 2026 Intel Corporation
+//
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// - Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdlib.h>
+
+#include "wcore_error.h"
+
+#include "linux_platform.h"
+
+#include "wegl_config.h"
+#include "wegl_context.h"
+#include "wegl_fence.h"
+#include "wegl_util.h"
+#include "wegl_window.h"
+
+#include "sl_display.h"
+#include "sl_platform.h"
+#include "sl_window.h"
+
+static const struct wcore_platform_vtbl sl_platform_vtbl;
+
+static bool
+sl_platform_destroy(struct wcore_platform *wc_self)
+{
+    struct sl_platform *self = sl_platform(wc_self);
+    bool ok = true;
+
+    if (!self)
+        return true;
+
+    if (self->linux)
+        ok &= linux_platform_destroy(self->linux);
+
+    ok &= wcore_platform_teardown(wc_self);
+    free(self);
+    return ok;
+}
+
+struct wcore_platform*
+sl_platform_create(void)
+{
+    struct sl_platform *self;
+    bool ok = true;
+
+    self = wcore_calloc(sizeof(*self));
+    if (self == NULL)
+        return NULL;
+
+    ok = wcore_platform_init(&self->wcore);
+    if (!ok)
+        goto error;
+
+    self->linux = linux_platform_create();
+    if (!self->linux)
+        goto error;
+
+    // Unlike the other EGL platforms, there is no need to set EGL_PLATFORM
+    // because the display is obtained with eglGetPlatformDisplayEXT.
+
+    self->wcore.vtbl = &sl_platform_vtbl;
+    return &self->wcore;
+
+error:
+    sl_platform_destroy(&self->wcore);
+    return NULL;
+}
+
+static bool
+sl_dl_can_open(struct wcore_platform *wc_self,
+               int32_t waffle_dl)
+{
+    return linux_platform_dl_can_open(sl_platform(wc_self)->linux,
+                                      waffle_dl);
+}
+
+static void*
+sl_dl_sym(struct wcore_platform *wc_self,
+          int32_t waffle_dl,
+          const char *name)
+{
+    return linux_platform_dl_sym(sl_platform(wc_self)->linux,
+                                 waffle_dl,
+                                 name);
+}
+
+static void
+sl_dl_sym_array(struct wcore_platform *wc_self,
+                int32_t waffle_dl,
+                int32_t count,
+                const char *const names[],
+                void *syms[])
+{
+    linux_platform_dl_sym_array(sl_platform(wc_self)->linux,
+                                waffle_dl, count, names, syms);
+}
+
+static void
+sl_get_symbol_cache_stats(struct wcore_platform *wc_self,
+                          struct waffle_symbol_cache_stats *stats)
+{
+    linux_platform_get_symbol_cache_stats(sl_platform(wc_self)->linux, stats);
+}
+
+static void*
+sl_get_proc_address(struct wcore_platform *wc_self,
+                    const char *name)
+{
+    return linux_platform_get_proc_address(sl_platform(wc_self)->linux,
+                                           wc_self, wegl_get_proc_address,
+                                           name);
+}
+
+static union waffle_native_config*
+sl_config_get_native(struct wcore_config *wc_config)
+{
+    struct sl_display *dpy = sl_display(wc_config->display);
+    struct wegl_config *config = wegl_config(wc_config);
+    union waffle_native_config *n_config;
+
+    WCORE_CREATE_NATIVE_UNION(n_config, surfaceless_egl);
+    if (!n_config)
+        return NULL;
+
+    sl_display_fill_native(dpy, &n_config->surfaceless_egl->display);
+    n_config->surfaceless_egl->egl_config = config->egl;
+
+    return n_config;
+}
+
+static union waffle_native_context*
+sl_context_get_native(struct wcore_context *wc_ctx)
+{
+    struct sl_display *dpy = sl_display(wc_ctx->display);
+    struct wegl_context *ctx = wegl_context(wc_ctx);
+    union waffle_native_context *n_ctx;
+
+    WCORE_CREATE_NATIVE_UNION(n_ctx, surfaceless_egl);
+    if (!n_ctx)
+        return NULL;
+
+    sl_display_fill_native(dpy, &n_ctx->surfaceless_egl->display);
+    n_ctx->surfaceless_egl->egl_context = ctx->egl;
+
+    return n_ctx;
+}
+
+static const struct wcore_platform_vtbl sl_platform_vtbl = {
+    .destroy = sl_platform_destroy,
+
+    .make_current = wegl_make_current,
+    .get_proc_address = sl_get_proc_address,
+    .dl_can_open = sl_dl_can_open,
+    .dl_sym = sl_dl_sym,
+    .dl_sym_array = sl_dl_sym_array,
+    .get_symbol_cache_stats = sl_get_symbol_cache_stats,
+
+    .display = {
+        .connect = sl_display_connect,
+        .destroy = sl_display_destroy,
+        .supports_context_api = wegl_display_supports_context_api,
+        .get_native = sl_display_get_native,
+    },
+
+    .config = {
+        .choose = wegl_config_choose,
+        .destroy = wegl_config_destroy,
+        .get_native = sl_config_get_native,
+        .get_attrib = wegl_config_get_attrib,
+    },
+
+    .context = {
+        .create = wegl_context_create,
+        .destroy = wegl_context_destroy,
+        .get_native = sl_context_get_native,
+        .get_priority = wegl_context_get_priority,
+    },
+
+    .window = {
+        .create = sl_window_create,
+        .destroy = sl_window_destroy,
+        .show = sl_window_show,
+        .swap_buffers = wegl_window_swap_buffers,
+        .swap_buffers_with_damage = wegl_window_swap_buffers_with_damage,
+        .get_buffer_age = wegl_window_get_buffer_age,
+        .set_damage_region = wegl_window_set_damage_region,
+        .set_swap_interval = wegl_window_set_swap_interval,
+        .get_native = sl_window_get_native,
+    },
+
+    .fence = {
+        .create = wegl_fence_create,
+        .destroy = wegl_fence_destroy,
+        .wait = wegl_fence_wait,
+        .export_fd = wegl_fence_export_fd,
+    },
+};
@@ -25,6 +25,7 @@
 
 #define WL_EGL_PLATFORM 1
 
+#include <errno.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -140,6 +141,9 @@ wayland_display_connect(struct wcore_platform *wc_plat,
         goto error;
     }
 
+    const char *throttle = getenv("WAFFLE_WAYLAND_THROTTLE");
+    self->throttle_swap = throttle && strcmp(throttle, "0") != 0;
+
     ok = wegl_display_init(&self->wegl, wc_plat, (intptr_t) self->wl_display);
     if (!ok)
         goto error;
@@ -186,3 +190,21 @@ wayland_display_sync(struct wayland_display *dpy)
 
     return true;
 }
+
+bool
+wayland_display_flush(struct wayland_display *dpy)
+{
+    if (wl_display_dispatch_pending(dpy->wl_display) == -1) {
+        wcore_error_errno("error on wl_display");
+        return false;
+    }
+
+    // If the socket buffer is full, the remaining requests are sent on the
+    // next flush. That is not an error.
+    if (wl_display_flush(dpy->wl_display) == -1 && errno != EAGAIN) {
+        wcore_error_errno("error on wl_display");
+        return false;
+    }
+
+    return true;
+}
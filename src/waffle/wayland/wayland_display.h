@@ -46,6 +46,12 @@ struct wayland_display {
     struct wl_compositor *wl_compositor;
     struct wl_shell *wl_shell;
 
+    /// @brief If set, waffle_window_swap_buffers() blocks until the
+    /// compositor has released the previous frame.
+    ///
+    /// Set by the environment variable WAFFLE_WAYLAND_THROTTLE=1.
+    bool throttle_swap;
+
     struct wegl_display wegl;
 };
 
@@ -90,3 +96,11 @@ wayland_display_get_native(struct wcore_display *wc_self);
 /// public entry points synchronous.
 bool
 wayland_display_sync(struct wayland_display *dpy);
+
+/// @brief Send buffered requests to the server without blocking.
+///
+/// Dispatch any events already read from the wl_display socket, then flush
+/// the client's request buffer. Unlike wayland_display_sync(), this does not
+/// wait for the server to reply.
+bool
+wayland_display_flush(struct wayland_display *dpy);
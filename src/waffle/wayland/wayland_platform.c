@@ -36,7 +36,9 @@
 
 #include "wegl_config.h"
 #include "wegl_context.h"
+#include "wegl_fence.h"
 #include "wegl_util.h"
+#include "wegl_window.h"
 
 #include "wayland_display.h"
 #include "wayland_platform.h"
@@ -109,6 +111,33 @@ wayland_dl_sym(struct wcore_platform *wc_self,
                                                   name);
 }
 
+static void
+wayland_dl_sym_array(struct wcore_platform *wc_self,
+                     int32_t waffle_dl,
+                     int32_t count,
+                     const char *const names[],
+                     void *syms[])
+{
+    linux_platform_dl_sym_array(wayland_platform(wc_self)->linux,
+                                waffle_dl, count, names, syms);
+}
+
+static void
+wayland_get_symbol_cache_stats(struct wcore_platform *wc_self,
+                               struct waffle_symbol_cache_stats *stats)
+{
+    linux_platform_get_symbol_cache_stats(wayland_platform(wc_self)->linux, stats);
+}
+
+static void*
+wayland_get_proc_address(struct wcore_platform *wc_self,
+                         const char *name)
+{
+    return linux_platform_get_proc_address(wayland_platform(wc_self)->linux,
+                                           wc_self, wegl_get_proc_address,
+                                           name);
+}
+
 static union waffle_native_config*
 wayland_config_get_native(struct wcore_config *wc_config)
 {
@@ -147,9 +176,11 @@ static const struct wcore_platform_vtbl wayland_platform_vtbl = {
     .destroy = wayland_platform_destroy,
 
     .make_current = wegl_make_current,
-    .get_proc_address = wegl_get_proc_address,
+    .get_proc_address = wayland_get_proc_address,
     .dl_can_open = wayland_dl_can_open,
     .dl_sym = wayland_dl_sym,
+    .dl_sym_array = wayland_dl_sym_array,
+    .get_symbol_cache_stats = wayland_get_symbol_cache_stats,
 
     .display = {
         .connect = wayland_display_connect,
@@ -162,12 +193,14 @@ static const struct wcore_platform_vtbl wayland_platform_vtbl = {
         .choose = wegl_config_choose,
         .destroy = wegl_config_destroy,
         .get_native = wayland_config_get_native,
+        .get_attrib = wegl_config_get_attrib,
     },
 
     .context = {
         .create = wegl_context_create,
         .destroy = wegl_context_destroy,
         .get_native = wayland_context_get_native,
+        .get_priority = wegl_context_get_priority,
     },
 
     .window = {
@@ -175,7 +208,19 @@ static const struct wcore_platform_vtbl wayland_platform_vtbl = {
         .destroy = wayland_window_destroy,
         .show = wayland_window_show,
         .swap_buffers = wayland_window_swap_buffers,
+        .swap_buffers_with_damage = wayland_window_swap_buffers_with_damage,
         .resize = wayland_window_resize,
+        .get_buffer_age = wegl_window_get_buffer_age,
+        .set_damage_region = wegl_window_set_damage_region,
+        .set_swap_interval = wegl_window_set_swap_interval,
+        .set_render_buffer = wegl_window_set_render_buffer,
         .get_native = wayland_window_get_native,
     },
+
+    .fence = {
+        .create = wegl_fence_create,
+        .destroy = wegl_fence_destroy,
+        .wait = wegl_fence_wait,
+        .export_fd = wegl_fence_export_fd,
+    },
 };
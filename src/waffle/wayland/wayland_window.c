@@ -36,6 +36,7 @@
 #include "wcore_error.h"
 
 #include "wegl_config.h"
+#include "wegl_util.h"
 
 #include "wayland_display.h"
 #include "wayland_window.h"
@@ -51,6 +52,9 @@ wayland_window_destroy(struct wcore_window *wc_self)
 
     ok &= wegl_window_teardown(&self->wegl);
 
+    if (self->frame_callback)
+        wl_callback_destroy(self->frame_callback);
+
     if (self->wl_window)
         wl_egl_window_destroy(self->wl_window);
 
@@ -174,21 +178,111 @@ wayland_window_show(struct wcore_window *wc_self)
     return true;
 }
 
-bool
-wayland_window_swap_buffers(struct wcore_window *wc_self)
+static void
+frame_callback_done(void *data,
+                    struct wl_callback *callback,
+                    uint32_t time)
 {
-   struct wayland_display *dpy = wayland_display(wc_self->display);
-   bool ok;
+    struct wayland_window *self = data;
 
-   ok = wegl_window_swap_buffers(wc_self);
-   if (!ok)
-      return false;
+    wl_callback_destroy(callback);
+    self->frame_callback = NULL;
+}
 
-   ok = wayland_display_sync(dpy);
-   if (!ok)
-      return false;
+static const struct wl_callback_listener frame_callback_listener = {
+    .done = frame_callback_done,
+};
 
-   return true;
+/// @brief Translate damage rectangles into wl_surface.damage requests.
+///
+/// The rectangles use the EGL convention of a lower-left origin, whereas
+/// wl_surface.damage uses surface coordinates with an upper-left origin.
+static bool
+wayland_window_post_damage(struct wayland_window *self,
+                           const int32_t *rects,
+                           int32_t n_rects)
+{
+    struct wegl_display *dpy = wegl_display(self->wegl.wcore.display);
+    EGLint height;
+
+    if (!eglQuerySurface(dpy->egl, self->wegl.egl, EGL_HEIGHT, &height)) {
+        wegl_emit_error("eglQuerySurface(EGL_HEIGHT)");
+        return false;
+    }
+
+    for (int32_t i = 0; i < n_rects; ++i) {
+        const int32_t *r = &rects[4 * i];
+        wl_surface_damage(self->wl_surface,
+                          r[0], height - r[1] - r[3], r[2], r[3]);
+    }
+
+    return true;
+}
+
+static bool
+wayland_window_swap(struct wcore_window *wc_self,
+                    const int32_t *rects,
+                    int32_t n_rects)
+{
+    struct wayland_window *self = wayland_window(wc_self);
+    struct wayland_display *dpy = wayland_display(wc_self->display);
+    bool ok;
+
+    // In throttled mode, wait until the compositor has presented the previous
+    // frame. Otherwise, never block on the compositor here; the pending
+    // callback is reaped by a later dispatch. A swap interval of 0 asks for
+    // unthrottled swaps, so it overrides throttled mode.
+    if (dpy->throttle_swap && self->wegl.swap_interval != 0) {
+        while (self->frame_callback) {
+            if (wl_display_dispatch(dpy->wl_display) == -1) {
+                wcore_error_errno("error on wl_display");
+                return false;
+            }
+        }
+    }
+
+    // Request the callback before eglSwapBuffers, which commits the surface.
+    if (!self->frame_callback) {
+        self->frame_callback = wl_surface_frame(self->wl_surface);
+        if (!self->frame_callback) {
+            wcore_errorf(WAFFLE_ERROR_UNKNOWN, "wl_surface_frame failed");
+            return false;
+        }
+
+        wl_callback_add_listener(self->frame_callback,
+                                 &frame_callback_listener,
+                                 self);
+    }
+
+    if (n_rects == 0) {
+        ok = wegl_window_swap_buffers(wc_self);
+    }
+    else if (dpy->wegl.swap_buffers_with_damage) {
+        // EGL sends the equivalent wl_surface.damage_buffer requests itself.
+        ok = wegl_window_swap_buffers_with_damage(wc_self, rects, n_rects);
+    }
+    else {
+        ok = wayland_window_post_damage(self, rects, n_rects)
+          && wegl_window_swap_buffers(wc_self);
+    }
+    if (!ok)
+        return false;
+
+    return wayland_display_flush(dpy);
+}
+
+bool
+wayland_window_swap_buffers(struct wcore_window *wc_self)
+{
+    return wayland_window_swap(wc_self, NULL, 0);
+}
+
+bool
+wayland_window_swap_buffers_with_damage(struct wcore_window *wc_self,
+                                        const int32_t *rects,
+                                        int32_t n_rects)
+{
+    return wayland_window_swap(wc_self, rects, n_rects);
 }
 
 bool
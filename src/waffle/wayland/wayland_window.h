@@ -41,6 +41,9 @@ struct wayland_window {
     struct wl_shell_surface *wl_shell_surface;
     struct wl_egl_window *wl_window;
 
+    /// @brief Pending wl_surface.frame callback, or null.
+    struct wl_callback *frame_callback;
+
     struct wegl_window wegl;
 };
 
@@ -71,6 +74,11 @@ wayland_window_show(struct wcore_window *wc_self);
 bool
 wayland_window_swap_buffers(struct wcore_window *wc_self);
 
+bool
+wayland_window_swap_buffers_with_damage(struct wcore_window *wc_self,
+                                        const int32_t *rects,
+                                        int32_t n_rects);
+
 bool
 wayland_window_resize(struct wcore_window *wc_self,
                       int32_t width, int32_t height);
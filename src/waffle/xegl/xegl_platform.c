@@ -31,7 +31,9 @@
 
 #include "wegl_config.h"
 #include "wegl_context.h"
+#include "wegl_fence.h"
 #include "wegl_util.h"
+#include "wegl_window.h"
 
 #include "linux_platform.h"
 
@@ -106,6 +108,33 @@ xegl_dl_sym(struct wcore_platform *wc_self,
                                                name);
 }
 
+static void
+xegl_dl_sym_array(struct wcore_platform *wc_self,
+                  int32_t waffle_dl,
+                  int32_t count,
+                  const char *const names[],
+                  void *syms[])
+{
+    linux_platform_dl_sym_array(xegl_platform(wc_self)->linux,
+                                waffle_dl, count, names, syms);
+}
+
+static void
+xegl_get_symbol_cache_stats(struct wcore_platform *wc_self,
+                            struct waffle_symbol_cache_stats *stats)
+{
+    linux_platform_get_symbol_cache_stats(xegl_platform(wc_self)->linux, stats);
+}
+
+static void*
+xegl_get_proc_address(struct wcore_platform *wc_self,
+                      const char *name)
+{
+    return linux_platform_get_proc_address(xegl_platform(wc_self)->linux,
+                                           wc_self, wegl_get_proc_address,
+                                           name);
+}
+
 static union waffle_native_config*
 xegl_config_get_native(struct wcore_config *wc_config)
 {
@@ -144,9 +173,11 @@ static const struct wcore_platform_vtbl xegl_platform_vtbl = {
     .destroy = xegl_platform_destroy,
 
     .make_current = wegl_make_current,
-    .get_proc_address = wegl_get_proc_address,
+    .get_proc_address = xegl_get_proc_address,
     .dl_can_open = xegl_dl_can_open,
     .dl_sym = xegl_dl_sym,
+    .dl_sym_array = xegl_dl_sym_array,
+    .get_symbol_cache_stats = xegl_get_symbol_cache_stats,
 
     .display = {
         .connect = xegl_display_connect,
@@ -159,12 +190,14 @@ static const struct wcore_platform_vtbl xegl_platform_vtbl = {
         .choose = wegl_config_choose,
         .destroy = wegl_config_destroy,
         .get_native = xegl_config_get_native,
+        .get_attrib = wegl_config_get_attrib,
     },
 
     .context = {
         .create = wegl_context_create,
         .destroy = wegl_context_destroy,
         .get_native = xegl_context_get_native,
+        .get_priority = wegl_context_get_priority,
     },
 
     .window = {
@@ -172,7 +205,19 @@ static const struct wcore_platform_vtbl xegl_platform_vtbl = {
         .destroy = xegl_window_destroy,
         .show = xegl_window_show,
         .resize = xegl_window_resize,
+        .get_buffer_age = wegl_window_get_buffer_age,
+        .set_damage_region = wegl_window_set_damage_region,
+        .set_swap_interval = wegl_window_set_swap_interval,
+        .set_render_buffer = wegl_window_set_render_buffer,
         .swap_buffers = wegl_window_swap_buffers,
+        .swap_buffers_with_damage = wegl_window_swap_buffers_with_damage,
         .get_native = xegl_window_get_native,
     },
+
+    .fence = {
+        .create = wegl_fence_create,
+        .destroy = wegl_fence_destroy,
+        .wait = wegl_fence_wait,
+        .export_fd = wegl_fence_export_fd,
+    },
 };
@@ -34,6 +34,8 @@
 ///     4. Verify the window contents with glReadPixels.
 ///     5. Tear down all waffle state.
 
+#define _POSIX_C_SOURCE 200809L // glibc feature macro for fileno.
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -43,6 +45,7 @@
 #include <sys/wait.h>
 
 #include "waffle.h"
+#include "waffle_gl_dispatch.h"
 #include "waffle_test/waffle_test.h"
 
 #include "gl_basic_cocoa.h"
@@ -101,6 +104,8 @@ typedef float               GLclampf;   /* single precision float in [0,1] */
 typedef double              GLdouble;   /* double precision float */
 typedef double              GLclampd;   /* double precision float in [0,1] */
 
+#define GL_NO_ERROR                 0x0000
+#define GL_INVALID_VALUE            0x0501
 #define GL_UNSIGNED_BYTE            0x1401
 #define GL_UNSIGNED_INT             0x1405
 #define GL_FLOAT                    0x1406
@@ -108,6 +113,7 @@ typedef double              GLclampd;   /* double precision float in [0,1] */
 #define GL_RGBA                     0x1908
 #define GL_COLOR_BUFFER_BIT         0x00004000
 #define GL_CONTEXT_FLAGS            0x821e
+#define GL_CONTEXT_RELEASE_BEHAVIOR 0x82fb
 
 #define GL_CONTEXT_FLAG_FORWARD_COMPATIBLE_BIT 0x00000001
 #define GL_CONTEXT_FLAG_DEBUG_BIT              0x00000002
@@ -172,7 +178,25 @@ gl_basic_init(int32_t waffle_platform)
         .profile = WAFFLE_DONT_CARE, \
         .forward_compatible = false, \
         .debug = false, \
+        .no_error = false, \
         .alpha = false, \
+        .color_format = WAFFLE_DONT_CARE, \
+        .release_behavior = WAFFLE_DONT_CARE, \
+        .priority = WAFFLE_DONT_CARE, \
+        .mutable_render_buffer = false, \
+        .no_config = false, \
+        .current_state = false, \
+        .dl_sym_array = false, \
+        .gl_dispatch = false, \
+        .swap_interval = false, \
+        .damage = false, \
+        .front_buffer = false, \
+        .dmabuf = false, \
+        .modifiers = false, \
+        .readback = false, \
+        .capture = false, \
+        .fence = false, \
+        .selection = WAFFLE_DONT_CARE, \
         .expect_error = WAFFLE_NO_ERROR, \
         __VA_ARGS__ \
         })
@@ -182,11 +206,170 @@ struct gl_basic_draw_args__ {
     int32_t version;
     int32_t profile;
     int32_t expect_error;
+    int32_t color_format;
+    int32_t release_behavior;
+    int32_t priority;
+    int32_t selection;
     bool forward_compatible;
     bool debug;
+    bool no_error;
+    bool mutable_render_buffer;
+    bool no_config;
+    bool current_state;
+    bool dl_sym_array;
+    bool gl_dispatch;
+    bool swap_interval;
+    bool damage;
+    bool front_buffer;
+    bool dmabuf;
+    bool modifiers;
+    bool readback;
+    bool capture;
+    bool fence;
     bool alpha;
 };
 
+/// Round @a bits up to a power of two of at least 8, as the texels that
+/// store them.
+static int64_t
+storage_bits(int64_t bits)
+{
+    int64_t storage = 8;
+
+    if (bits <= 0)
+        return 0;
+
+    while (storage < bits)
+        storage *= 2;
+
+    return storage;
+}
+
+/// Return the bits per pixel of the config's buffers, or -1.
+static int64_t
+config_footprint(struct waffle_config *config)
+{
+    static const int32_t attribs[] = {
+        WAFFLE_RED_SIZE, WAFFLE_GREEN_SIZE, WAFFLE_BLUE_SIZE,
+        WAFFLE_ALPHA_SIZE, WAFFLE_DEPTH_SIZE, WAFFLE_STENCIL_SIZE,
+    };
+    int64_t groups[2] = { 0, 0 };
+    int64_t bits;
+    int32_t value;
+
+    for (unsigned j = 0; j < sizeof(attribs) / sizeof(attribs[0]); ++j) {
+        if (!waffle_config_get_attrib(config, attribs[j], &value))
+            return -1;
+        // Color, then depth and stencil.
+        groups[j >= 4] += value;
+    }
+
+    bits = storage_bits(groups[0]) + storage_bits(groups[1]);
+
+    if (!waffle_config_get_attrib(config, WAFFLE_SAMPLES, &value))
+        return -1;
+
+    return value > 1 ? bits * value : bits;
+}
+
+static void
+count_and_release_front_buffer(struct waffle_window *window,
+                               void *buffer,
+                               void *user_data)
+{
+    ++*(int *) user_data;
+    waffle_window_release_front_buffer(window, buffer);
+}
+
+/// An asynchronous readback of the frame drawn in @a window must match the
+/// pixels read by the draw. The context must be OpenGL ES 3.0 or later.
+static void
+gl_basic_readback(struct waffle_context *ctx, struct waffle_window *window)
+{
+    struct waffle_readback *readback;
+    const void *data;
+
+    ASSERT_TRUE(readback = waffle_readback_create(ctx,
+                                                  WINDOW_WIDTH, WINDOW_HEIGHT,
+                                                  GL_RGBA, 2));
+    ASSERT_TRUE(waffle_readback_map_oldest(readback) == NULL);
+    ASSERT_TRUE(waffle_error_get_code() == WAFFLE_ERROR_BAD_PARAMETER);
+    ASSERT_TRUE(waffle_readback_begin(readback, window));
+
+    // A GL error left pending by the application survives the readback.
+    glClear(~0u);
+    ASSERT_TRUE(waffle_readback_begin(readback, window));
+    ASSERT_TRUE(glGetError() == GL_INVALID_VALUE);
+    ASSERT_TRUE(!waffle_readback_begin(readback, window));
+    ASSERT_TRUE(waffle_readback_get_num_pending(readback) == 2);
+
+    for (int j = 0; j < 2; ++j) {
+        ASSERT_TRUE(data = waffle_readback_map_oldest(readback));
+        ASSERT_TRUE(memcmp(data, pixels, sizeof(pixels)) == 0);
+        ASSERT_TRUE(waffle_readback_unmap(readback));
+    }
+    ASSERT_TRUE(waffle_readback_get_num_pending(readback) == 0);
+    ASSERT_TRUE(waffle_readback_destroy(readback));
+}
+
+/// Capture three swaps of @a window, whose frames must match the pixels
+/// read by the draw. A context without readback support drops the frames,
+/// but its swaps must still succeed.
+static void
+gl_basic_capture(struct waffle_window *window)
+{
+    FILE *capture_file = tmpfile();
+    ASSERT_TRUE(capture_file);
+    const int32_t capture_attribs[] = {
+        WAFFLE_CAPTURE_FD,          fileno(capture_file),
+        WAFFLE_CAPTURE_QUEUE_DEPTH, 2,
+        0,
+    };
+    struct waffle_capture *capture;
+    struct waffle_capture_stats stats;
+    static uint8_t frame[sizeof(pixels)];
+
+    ASSERT_TRUE(!waffle_window_attach_capture(window, NULL));
+    ASSERT_TRUE(waffle_error_get_code() == WAFFLE_ERROR_BAD_ATTRIBUTE);
+    ASSERT_TRUE(capture = waffle_window_attach_capture(window,
+                                                       capture_attribs));
+    ASSERT_TRUE(!waffle_window_attach_capture(window, capture_attribs));
+    ASSERT_TRUE(waffle_error_get_code() == WAFFLE_ERROR_BAD_PARAMETER);
+
+    // The sink's frame size is fixed at attach.
+    ASSERT_TRUE(!waffle_window_resize(window, WINDOW_WIDTH / 2,
+                                      WINDOW_HEIGHT / 2));
+    ASSERT_TRUE(waffle_error_get_code() == WAFFLE_ERROR_BAD_PARAMETER);
+
+    // A frame that cannot be captured leaves no error behind the swap.
+    for (int j = 0; j < 3; ++j) {
+        ASSERT_GL(glClear(GL_COLOR_BUFFER_BIT));
+        ASSERT_TRUE(waffle_window_swap_buffers(window));
+        ASSERT_TRUE(waffle_error_get_code() == WAFFLE_NO_ERROR);
+    }
+    ASSERT_TRUE(waffle_capture_get_stats(capture, &stats));
+    ASSERT_TRUE(stats.max_queue_depth <= 2);
+    if (stats.frames_dropped == 0) {
+        ASSERT_TRUE(stats.last_error == WAFFLE_NO_ERROR);
+    }
+    else {
+        ASSERT_TRUE(stats.frames_dropped == 3);
+        ASSERT_TRUE(stats.last_error == WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+    }
+    ASSERT_TRUE(waffle_capture_detach(capture));
+
+    // The frames are uniform, so each must match whatever its row order.
+    rewind(capture_file);
+    if (stats.frames_dropped == 0) {
+        for (int j = 0; j < 3; ++j) {
+            ASSERT_TRUE(fread(frame, sizeof(frame), 1, capture_file) == 1);
+            ASSERT_TRUE(memcmp(frame, pixels, sizeof(pixels)) == 0);
+        }
+    }
+    ASSERT_TRUE(fread(frame, 1, 1, capture_file) == 0);
+    fclose(capture_file);
+}
+
 static void
 gl_basic_draw__(struct gl_basic_draw_args__ args)
 {
@@ -196,15 +379,36 @@ gl_basic_draw__(struct gl_basic_draw_args__ args)
     int32_t expect_error = args.expect_error;
     bool context_forward_compatible = args.forward_compatible;
     bool context_debug = args.debug;
+    bool context_no_error = args.no_error;
     bool alpha = args.alpha;
+    int32_t color_format = args.color_format;
+    int32_t release_behavior = args.release_behavior;
+    int32_t priority = args.priority;
+    bool mutable_render_buffer = args.mutable_render_buffer;
+    bool no_config = args.no_config;
+    bool current_state = args.current_state;
+    bool dl_sym_array = args.dl_sym_array;
+    bool gl_dispatch = args.gl_dispatch;
+    bool swap_interval = args.swap_interval;
+    bool damage = args.damage;
+    bool front_buffer = args.front_buffer;
+    bool dmabuf = args.dmabuf;
+    bool modifiers = args.modifiers;
+    bool readback = args.readback;
+    bool capture = args.capture;
+    bool fence = args.fence;
+    int32_t selection = args.selection;
 
     int32_t libgl;
 
     int32_t config_attrib_list[64];
+    int no_config_index = -1;
+    int selection_index = -1;
     int i;
 
     struct waffle_display *dpy = NULL;
     struct waffle_config *config = NULL;
+    struct waffle_config *window_config = NULL;
     struct waffle_window *window = NULL;
     struct waffle_context *ctx = NULL;
 
@@ -231,14 +435,46 @@ gl_basic_draw__(struct gl_basic_draw_args__ args)
         config_attrib_list[i++] = WAFFLE_CONTEXT_DEBUG;
         config_attrib_list[i++] = true;
     }
-    config_attrib_list[i++] = WAFFLE_RED_SIZE;
-    config_attrib_list[i++] = 8;
-    config_attrib_list[i++] = WAFFLE_GREEN_SIZE;
-    config_attrib_list[i++] = 8;
-    config_attrib_list[i++] = WAFFLE_BLUE_SIZE;
-    config_attrib_list[i++] = 8;
-    config_attrib_list[i++] = WAFFLE_ALPHA_SIZE;
-    config_attrib_list[i++] = alpha;
+    if (context_no_error) {
+        config_attrib_list[i++] = WAFFLE_CONTEXT_NO_ERROR;
+        config_attrib_list[i++] = true;
+    }
+    if (release_behavior != WAFFLE_DONT_CARE) {
+        config_attrib_list[i++] = WAFFLE_CONTEXT_RELEASE_BEHAVIOR;
+        config_attrib_list[i++] = release_behavior;
+    }
+    if (priority != WAFFLE_DONT_CARE) {
+        config_attrib_list[i++] = WAFFLE_CONTEXT_PRIORITY;
+        config_attrib_list[i++] = priority;
+    }
+    if (mutable_render_buffer) {
+        config_attrib_list[i++] = WAFFLE_MUTABLE_RENDER_BUFFER;
+        config_attrib_list[i++] = true;
+    }
+    if (color_format != WAFFLE_DONT_CARE) {
+        config_attrib_list[i++] = WAFFLE_COLOR_FORMAT;
+        config_attrib_list[i++] = color_format;
+    } else {
+        config_attrib_list[i++] = WAFFLE_RED_SIZE;
+        config_attrib_list[i++] = 8;
+        config_attrib_list[i++] = WAFFLE_GREEN_SIZE;
+        config_attrib_list[i++] = 8;
+        config_attrib_list[i++] = WAFFLE_BLUE_SIZE;
+        config_attrib_list[i++] = 8;
+        config_attrib_list[i++] = WAFFLE_ALPHA_SIZE;
+        config_attrib_list[i++] = alpha;
+    }
+    if (selection != WAFFLE_DONT_CARE) {
+        selection_index = i;
+        config_attrib_list[i++] = WAFFLE_CONFIG_SELECTION;
+        config_attrib_list[i++] = selection;
+    }
+    if (no_config) {
+        // Last, so that truncating the list here yields the window's config.
+        no_config_index = i;
+        config_attrib_list[i++] = WAFFLE_CONTEXT_NO_CONFIG;
+        config_attrib_list[i++] = true;
+    }
     config_attrib_list[i++] = 0;
 
     // Check that we've set the EGL_PLATFORM environment variable for Mesa.
@@ -272,8 +508,51 @@ gl_basic_draw__(struct gl_basic_draw_args__ args)
         }
     }
 
-    ASSERT_TRUE(window = waffle_window_create(config,
+    // A config-less context renders to windows of another config.
+    window_config = config;
+    if (no_config) {
+        ASSERT_TRUE(!waffle_window_create(config, WINDOW_WIDTH, WINDOW_HEIGHT));
+        ASSERT_TRUE(waffle_error_get_code() == WAFFLE_ERROR_BAD_PARAMETER);
+
+        config_attrib_list[no_config_index] = 0;
+        ASSERT_TRUE(window_config = waffle_config_choose(dpy,
+                                                         config_attrib_list));
+    }
+
+    ASSERT_TRUE(window = waffle_window_create(window_config,
                                               WINDOW_WIDTH, WINDOW_HEIGHT));
+
+    // A config-less context has no attributes to query.
+    int32_t red_size;
+    if (no_config) {
+        ASSERT_TRUE(!waffle_config_get_attrib(config, WAFFLE_RED_SIZE,
+                                              &red_size));
+        ASSERT_TRUE(waffle_error_get_code() == WAFFLE_ERROR_BAD_PARAMETER);
+    }
+
+    // The chosen config meets the request, and the smallest config is no
+    // larger than the one in spec order.
+    if (selection != WAFFLE_DONT_CARE) {
+        ASSERT_TRUE(!waffle_config_get_attrib(window_config,
+                                              WAFFLE_DOUBLE_BUFFERED,
+                                              &red_size));
+        ASSERT_TRUE(waffle_error_get_code() == WAFFLE_ERROR_BAD_ATTRIBUTE);
+        ASSERT_TRUE(waffle_config_get_attrib(window_config, WAFFLE_RED_SIZE,
+                                             &red_size));
+        ASSERT_TRUE(red_size >= 5);
+    }
+    if (selection == WAFFLE_CONFIG_SELECTION_SMALLEST) {
+        struct waffle_config *spec_config;
+        int64_t smallest = config_footprint(window_config);
+
+        config_attrib_list[selection_index + 1] =
+            WAFFLE_CONFIG_SELECTION_SPEC_ORDER;
+        ASSERT_TRUE(spec_config = waffle_config_choose(dpy,
+                                                       config_attrib_list));
+        ASSERT_TRUE(smallest > 0);
+        ASSERT_TRUE(smallest <= config_footprint(spec_config));
+        ASSERT_TRUE(waffle_config_destroy(spec_config));
+    }
     ASSERT_TRUE(waffle_window_show(window));
 
     ctx = waffle_context_create(config, NULL);
@@ -291,6 +570,15 @@ gl_basic_draw__(struct gl_basic_draw_args__ args)
         }
     }
 
+    // The platform may grant a priority other than the one requested.
+    if (priority != WAFFLE_DONT_CARE) {
+        int32_t granted_priority;
+        ASSERT_TRUE(waffle_context_get_priority(ctx, &granted_priority));
+        ASSERT_TRUE(granted_priority == WAFFLE_CONTEXT_PRIORITY_HIGH ||
+                    granted_priority == WAFFLE_CONTEXT_PRIORITY_MEDIUM ||
+                    granted_priority == WAFFLE_CONTEXT_PRIORITY_LOW);
+    }
+
     // Get OpenGL functions.
     ASSERT_TRUE(glClear         = waffle_dl_sym(libgl, "glClear"));
     ASSERT_TRUE(glClearColor    = waffle_dl_sym(libgl, "glClearColor"));
@@ -298,8 +586,47 @@ gl_basic_draw__(struct gl_basic_draw_args__ args)
     ASSERT_TRUE(glGetIntegerv   = waffle_dl_sym(libgl, "glGetIntegerv"));
     ASSERT_TRUE(glReadPixels    = waffle_dl_sym(libgl, "glReadPixels"));
 
+    // The array variant must agree with waffle_dl_sym().
+    if (dl_sym_array) {
+        const char *const gl_names[] = {"glClear", "glReadPixels", "glBogus"};
+        void *gl_syms[3];
+
+        ASSERT_TRUE(!waffle_dl_sym_array(libgl, 2, gl_names, NULL));
+        ASSERT_TRUE(waffle_error_get_code() == WAFFLE_ERROR_BAD_PARAMETER);
+        ASSERT_TRUE(waffle_dl_sym_array(libgl, 2, gl_names, gl_syms));
+        ASSERT_TRUE(gl_syms[0] == (void*) glClear);
+        ASSERT_TRUE(gl_syms[1] == (void*) glReadPixels);
+        ASSERT_TRUE(!waffle_dl_sym_array(libgl, 3, gl_names, gl_syms));
+        ASSERT_TRUE(gl_syms[0] == (void*) glClear);
+        ASSERT_TRUE(gl_syms[2] == NULL);
+    }
+
     ASSERT_TRUE(waffle_make_current(dpy, window, ctx));
 
+    // The current objects are tracked, and rebinding them must succeed.
+    if (current_state) {
+        ASSERT_TRUE(waffle_get_current_display() == dpy);
+        ASSERT_TRUE(waffle_get_current_window() == window);
+        ASSERT_TRUE(waffle_get_current_context() == ctx);
+        ASSERT_TRUE(waffle_make_current(dpy, window, ctx));
+    }
+
+    if (swap_interval) {
+        ASSERT_TRUE(!waffle_window_set_swap_interval(window, -2));
+        ASSERT_TRUE(waffle_error_get_code() == WAFFLE_ERROR_BAD_PARAMETER);
+        if (!waffle_window_set_swap_interval(window, 0)) {
+            ASSERT_TRUE(waffle_error_get_code()
+                        == WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        }
+    }
+
+    if (mutable_render_buffer) {
+        ASSERT_TRUE(!waffle_window_set_render_buffer(window, WAFFLE_NONE));
+        ASSERT_TRUE(waffle_error_get_code() == WAFFLE_ERROR_BAD_PARAMETER);
+        ASSERT_TRUE(waffle_window_set_render_buffer(window,
+                                                    WAFFLE_RENDER_BUFFER_SINGLE));
+    }
+
     GLint context_flags = 0;
     if (context_forward_compatible || context_debug) {
         glGetIntegerv(GL_CONTEXT_FLAGS, &context_flags);
@@ -313,14 +640,124 @@ gl_basic_draw__(struct gl_basic_draw_args__ args)
         ASSERT_TRUE(context_flags & GL_CONTEXT_FLAG_DEBUG_BIT);
     }
 
+    // The query requires GL_KHR_context_flush_control, so an implementation
+    // may reject it even though the context honors the behavior.
+    if (release_behavior == WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE) {
+        GLint behavior = -1;
+        glGetIntegerv(GL_CONTEXT_RELEASE_BEHAVIOR, &behavior);
+        if (glGetError() == GL_NO_ERROR) {
+            ASSERT_TRUE(behavior == 0);
+        }
+    }
+
+    // The buffer age must be queried before the damage region is set.
+    if (damage) {
+        int32_t buffer_age = -1;
+
+        if (waffle_window_get_buffer_age(window, &buffer_age)) {
+            ASSERT_TRUE(buffer_age >= 0);
+
+            const int32_t region[] = { 0, 0, WINDOW_WIDTH, WINDOW_HEIGHT };
+            if (!waffle_window_set_damage_region(window, region, 1)) {
+                ASSERT_TRUE(waffle_error_get_code()
+                            == WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+            }
+        }
+        else {
+            ASSERT_TRUE(waffle_error_get_code()
+                        == WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        }
+    }
+
     // Draw.
     ASSERT_GL(glClearColor(RED_F, GREEN_F, BLUE_F, ALPHA_F));
     ASSERT_GL(glClear(GL_COLOR_BUFFER_BIT));
     ASSERT_GL(glReadPixels(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT,
                            GL_RGBA, GL_UNSIGNED_BYTE,
                            pixels));
+
+    if (readback) {
+        gl_basic_readback(ctx, window);
+    }
+
+    // A fence inserted after the draw signals once the GPU reaches it.
+    if (fence) {
+        struct waffle_fence *draw_fence;
+
+        ASSERT_TRUE(draw_fence = waffle_fence_create(ctx));
+        ASSERT_TRUE(waffle_fence_wait(draw_fence, WAFFLE_FENCE_WAIT_FOREVER));
+        ASSERT_TRUE(waffle_fence_is_signaled(draw_fence));
+
+        int fence_fd = waffle_fence_export_fd(draw_fence);
+        if (fence_fd >= 0) {
+            close(fence_fd);
+        }
+        else {
+            ASSERT_TRUE(waffle_error_get_code()
+                        == WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        }
+        ASSERT_TRUE(waffle_fence_destroy(draw_fence));
+    }
+
     ASSERT_TRUE(waffle_window_swap_buffers(window));
 
+    if (damage) {
+        const int32_t rects[] = { 0, 0, WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2 };
+
+        ASSERT_GL(glClear(GL_COLOR_BUFFER_BIT));
+        ASSERT_TRUE(waffle_window_swap_buffers_with_damage(window, rects, 1));
+        ASSERT_TRUE(!waffle_window_swap_buffers_with_damage(window, NULL, 1));
+        ASSERT_TRUE(waffle_error_get_code() == WAFFLE_ERROR_BAD_PARAMETER);
+    }
+
+    if (capture) {
+        gl_basic_capture(window);
+    }
+
+    // A front buffer consumer sees every swap and can release the buffers it
+    // is given, so the window never runs out of them.
+    if (front_buffer) {
+        int front_buffers = 0;
+
+        ASSERT_TRUE(waffle_window_set_front_buffer_callback(
+                        window, count_and_release_front_buffer,
+                        &front_buffers));
+        for (int j = 0; j < 8; ++j) {
+            ASSERT_GL(glClear(GL_COLOR_BUFFER_BIT));
+            ASSERT_TRUE(waffle_window_swap_buffers(window));
+        }
+        ASSERT_TRUE(front_buffers == 8);
+        ASSERT_TRUE(waffle_window_set_front_buffer_callback(window, NULL,
+                                                            NULL));
+    }
+
+    // Export the buffer posted by the last swap.
+    if (dmabuf) {
+        struct waffle_dmabuf buf;
+
+        ASSERT_TRUE(waffle_window_export_dmabuf(window, &buf));
+        ASSERT_TRUE(buf.num_planes >= 1);
+        ASSERT_TRUE(buf.width == WINDOW_WIDTH);
+        ASSERT_TRUE(buf.height == WINDOW_HEIGHT);
+        for (int j = 0; j < buf.num_planes; ++j) {
+            ASSERT_TRUE(buf.fds[j] >= 0);
+            close(buf.fds[j]);
+        }
+    }
+
+    // The first call through each entry resolves it; the second is direct.
+    if (gl_dispatch) {
+        const struct waffle_gl_dispatch *gl;
+
+        ASSERT_TRUE(gl = waffle_context_get_gl_dispatch(ctx));
+        ASSERT_TRUE(gl == waffle_context_get_gl_dispatch(ctx));
+        for (int j = 0; j < 2; ++j) {
+            ASSERT_TRUE(gl->glGetError() == GL_NO_ERROR);
+            gl->glClear(GL_COLOR_BUFFER_BIT);
+            ASSERT_TRUE(gl->glGetError() == GL_NO_ERROR);
+        }
+    }
+
     // Probe color buffer.
     //
     // Fail at first failing pixel. If the draw fails, we don't want a terminal
@@ -335,10 +772,33 @@ gl_basic_draw__(struct gl_basic_draw_args__ args)
         }
     }
 
+    // EGL may lack EGL_EXT_image_dma_buf_import_modifiers.
+    if (modifiers) {
+        struct waffle_window *modifier_window =
+            waffle_window_create_with_modifiers(window_config,
+                                                WINDOW_WIDTH, WINDOW_HEIGHT,
+                                                NULL, 0);
+        if (modifier_window) {
+            ASSERT_TRUE(waffle_window_destroy(modifier_window));
+        }
+        else {
+            ASSERT_TRUE(waffle_error_get_code()
+                        == WAFFLE_ERROR_UNSUPPORTED_ON_PLATFORM);
+        }
+    }
+
     // Teardown.
     ABORT_IF(!waffle_make_current(dpy, NULL, NULL));
+    if (current_state) {
+        ASSERT_TRUE(waffle_get_current_display() == NULL);
+        ASSERT_TRUE(waffle_get_current_window() == NULL);
+        ASSERT_TRUE(waffle_get_current_context() == NULL);
+    }
     ASSERT_TRUE(waffle_window_destroy(window));
     ASSERT_TRUE(waffle_context_destroy(ctx));
+    if (window_config != config) {
+        ASSERT_TRUE(waffle_config_destroy(window_config));
+    }
     ASSERT_TRUE(waffle_config_destroy(config));
     ASSERT_TRUE(waffle_display_disconnect(dpy));
 }
@@ -606,6 +1066,12 @@ TEST(gl_basic, glx_gl_debug)
                   .debug=true);
 }
 
+TEST(gl_basic, glx_gl_swap_interval)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .swap_interval=true);
+}
+
 TEST(gl_basic, glx_gl_fwdcompat_bad_attribute)
 {
     gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
@@ -875,6 +1341,7 @@ testsuite_glx(void)
     TEST_RUN(gl_basic, glx_gl_rgb);
     TEST_RUN(gl_basic, glx_gl_rgba);
     TEST_RUN(gl_basic, glx_gl_debug);
+    TEST_RUN(gl_basic, glx_gl_swap_interval);
     TEST_RUN(gl_basic, glx_gl_fwdcompat_bad_attribute);
 
     TEST_RUN(gl_basic, glx_gl10);
@@ -1174,6 +1641,18 @@ TEST(gl_basic, wayland_gles2_rgba)
                   .alpha=true);
 }
 
+TEST(gl_basic, wayland_gles2_swap_interval)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .swap_interval=true);
+}
+
+TEST(gl_basic, wayland_gles2_damage)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .damage=true);
+}
+
 TEST(gl_basic, wayland_gles20)
 {
     gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
@@ -1259,6 +1738,8 @@ testsuite_wayland(void)
 
     TEST_RUN(gl_basic, wayland_gles2_rgb);
     TEST_RUN(gl_basic, wayland_gles2_rgba);
+    TEST_RUN(gl_basic, wayland_gles2_swap_interval);
+    TEST_RUN(gl_basic, wayland_gles2_damage);
     TEST_RUN(gl_basic, wayland_gles2_fwdcompat_bad_attribute);
 
     TEST_RUN(gl_basic, wayland_gles20);
@@ -1518,6 +1999,18 @@ TEST(gl_basic, x11_egl_gles2_rgba)
                   .alpha=true);
 }
 
+TEST(gl_basic, x11_egl_gles2_swap_interval)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .swap_interval=true);
+}
+
+TEST(gl_basic, x11_egl_gles2_damage)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .damage=true);
+}
+
 TEST(gl_basic, x11_egl_gles20)
 {
     gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
@@ -1603,6 +2096,8 @@ testsuite_x11_egl(void)
 
     TEST_RUN(gl_basic, x11_egl_gles2_rgb);
     TEST_RUN(gl_basic, x11_egl_gles2_rgba);
+    TEST_RUN(gl_basic, x11_egl_gles2_swap_interval);
+    TEST_RUN(gl_basic, x11_egl_gles2_damage);
     TEST_RUN(gl_basic, x11_egl_gles2_fwdcompat_bad_attribute);
 
     TEST_RUN(gl_basic, x11_egl_gles20);
@@ -1615,76 +2110,1159 @@ testsuite_x11_egl(void)
 }
 #endif // WAFFLE_HAS_X11_EGL
 
-static void
-usage_error(void)
+#ifdef WAFFLE_HAS_GBM
+TEST(gl_basic, gbm_init)
 {
-    fprintf(stderr, "gl_basic_test: usage error\n");
-    exit(1);
+    gl_basic_init(WAFFLE_PLATFORM_GBM);
+}
+
+TEST(gl_basic, gbm_gl_rgb)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL);
+}
+
+TEST(gl_basic, gbm_gles2_rgb)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2);
+}
+
+TEST(gl_basic, gbm_gles2_rgba)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .alpha=true);
+}
+
+TEST(gl_basic, gbm_gles2_front_buffer)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .front_buffer=true);
+}
+
+TEST(gl_basic, gbm_gles2_swap_interval)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .swap_interval=true);
+}
+
+TEST(gl_basic, gbm_gles2_damage)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .damage=true);
+}
+
+TEST(gl_basic, gbm_gles2_dmabuf)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .dmabuf=true);
+}
+
+TEST(gl_basic, gbm_gles2_modifiers)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .modifiers=true);
+}
+
+TEST(gl_basic, gbm_gles3_rgb)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES3);
 }
 
-/// Run the testsuite in a separate process. If the testsuite fails, then exit
-/// immediately.
 static void
-run_testsuite(void (*testsuite)(void))
+testsuite_gbm(void)
 {
-    pid_t pid = fork();
-    int status;
+    TEST_RUN(gl_basic, gbm_init);
 
-    if (pid > 0) {
-        waitpid(pid, &status, 0);
-        int exit_status = WEXITSTATUS(status);
-        // exit_status is number of failures.
-        if (exit_status == 0) {
-            // All tests passed.
-            return;
-        }
-        else if (exit_status > 0) {
-            // Some tests failed. Don't run any more tests.
-            exit(exit_status);
-        }
-        else {
-            fprintf(stderr, "gl_basic_test: error: child process aborted\n");
-            abort();
-        }
-    }
-    else if (pid == 0) {
-        #ifdef __APPLE__
-            gl_basic_cocoa_init();
-        #endif
+    TEST_RUN(gl_basic, gbm_gl_rgb);
 
-        void (*testsuites[])(void) = {testsuite, 0};
-        int argc = 0;
-        int num_failures = wt_main(&argc, NULL, testsuites);
+    TEST_RUN(gl_basic, gbm_gles2_rgb);
+    TEST_RUN(gl_basic, gbm_gles2_rgba);
+    TEST_RUN(gl_basic, gbm_gles2_front_buffer);
+    TEST_RUN(gl_basic, gbm_gles2_swap_interval);
+    TEST_RUN(gl_basic, gbm_gles2_damage);
+    TEST_RUN(gl_basic, gbm_gles2_dmabuf);
+    TEST_RUN(gl_basic, gbm_gles2_modifiers);
 
-        #ifdef __APPLE__
-            gl_basic_cocoa_finish();
-        #endif
+    TEST_RUN(gl_basic, gbm_gles3_rgb);
+}
+#endif // WAFFLE_HAS_GBM
 
-        exit(num_failures);
-    }
-    else {
-        fprintf(stderr, "gl_basic_test: error: fork failed\n");
-        abort();
-    }
+#ifdef WAFFLE_HAS_SURFACELESS_EGL
+TEST(gl_basic, surfaceless_egl_init)
+{
+    gl_basic_init(WAFFLE_PLATFORM_SURFACELESS_EGL);
 }
 
-int
-main(int argc, char *argv[])
+TEST(gl_basic, surfaceless_egl_gl_rgb)
 {
-    if (argc != 1)
-        usage_error();
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL);
+}
 
-#ifdef WAFFLE_HAS_CGL
-    run_testsuite(testsuite_cgl);
-#endif
-#ifdef WAFFLE_HAS_GLX
-    run_testsuite(testsuite_glx);
-#endif
-#ifdef WAFFLE_HAS_WAYLAND
-    run_testsuite(testsuite_wayland);
-#endif
-#ifdef WAFFLE_HAS_X11_EGL
-    run_testsuite(testsuite_x11_egl);
+TEST(gl_basic, surfaceless_egl_gl_rgba)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .alpha=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gl_debug)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .debug=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gl_fwdcompat_bad_attribute)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .forward_compatible=true,
+                  .expect_error=WAFFLE_ERROR_BAD_ATTRIBUTE);
+}
+
+TEST(gl_basic, surfaceless_egl_gl10)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=10);
+}
+
+TEST(gl_basic, surfaceless_egl_gl11)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=11);
+}
+
+TEST(gl_basic, surfaceless_egl_gl12)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=12);
+}
+
+TEST(gl_basic, surfaceless_egl_gl13)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=13);
+}
+
+TEST(gl_basic, surfaceless_egl_gl14)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=14);
+}
+
+TEST(gl_basic, surfaceless_egl_gl15)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=15);
+}
+
+TEST(gl_basic, surfaceless_egl_gl20)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=20);
+}
+
+TEST(gl_basic, surfaceless_egl_gl21)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=21);
+}
+
+TEST(gl_basic, surfaceless_egl_gl21_fwdcompat_bad_attribute)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=21,
+                  .forward_compatible=true,
+                  .expect_error=WAFFLE_ERROR_BAD_ATTRIBUTE);
+}
+
+TEST(gl_basic, surfaceless_egl_gl30)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=30);
+}
+
+TEST(gl_basic, surfaceless_egl_gl30_fwdcompat)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=30,
+                  .forward_compatible=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gl31)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=31);
+}
+
+TEST(gl_basic, surfaceless_egl_gl31_fwdcompat)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=31,
+                  .forward_compatible=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gl32_core)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=32,
+                  .profile=WAFFLE_CONTEXT_CORE_PROFILE);
+}
+
+TEST(gl_basic, surfaceless_egl_gl32_core_fwdcompat)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=32,
+                  .profile=WAFFLE_CONTEXT_CORE_PROFILE,
+                  .forward_compatible=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gl33_core)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=33,
+                  .profile=WAFFLE_CONTEXT_CORE_PROFILE);
+}
+
+TEST(gl_basic, surfaceless_egl_gl40_core)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=40,
+                  .profile=WAFFLE_CONTEXT_CORE_PROFILE);
+}
+
+TEST(gl_basic, surfaceless_egl_gl41_core)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=41,
+                  .profile=WAFFLE_CONTEXT_CORE_PROFILE);
+}
+
+TEST(gl_basic, surfaceless_egl_gl42_core)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=42,
+                  .profile=WAFFLE_CONTEXT_CORE_PROFILE);
+}
+
+TEST(gl_basic, surfaceless_egl_gl43_core)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=43,
+                  .profile=WAFFLE_CONTEXT_CORE_PROFILE);
+}
+
+TEST(gl_basic, surfaceless_egl_gl32_compat)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=32,
+                  .profile=WAFFLE_CONTEXT_COMPATIBILITY_PROFILE);
+}
+
+TEST(gl_basic, surfaceless_egl_gl33_compat)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=33,
+                  .profile=WAFFLE_CONTEXT_COMPATIBILITY_PROFILE);
+}
+
+TEST(gl_basic, surfaceless_egl_gl40_compat)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=40,
+                  .profile=WAFFLE_CONTEXT_COMPATIBILITY_PROFILE);
+}
+
+TEST(gl_basic, surfaceless_egl_gl41_compat)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=41,
+                  .profile=WAFFLE_CONTEXT_COMPATIBILITY_PROFILE);
+}
+
+TEST(gl_basic, surfaceless_egl_gl42_compat)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=42,
+                  .profile=WAFFLE_CONTEXT_COMPATIBILITY_PROFILE);
+}
+
+TEST(gl_basic, surfaceless_egl_gl43_compat)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=43,
+                  .profile=WAFFLE_CONTEXT_COMPATIBILITY_PROFILE);
+}
+
+TEST(gl_basic, surfaceless_egl_gles1_rgb)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES1);
+}
+
+TEST(gl_basic, surfaceless_egl_gles1_rgba)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES1,
+                  .alpha=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gles10)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES1,
+                  .version=10,
+                  .alpha=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gles11)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES1,
+                  .version=11,
+                  .alpha=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gles1_fwdcompat_bad_attribute)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES1,
+                  .forward_compatible=true,
+                  .expect_error=WAFFLE_ERROR_BAD_ATTRIBUTE);
+}
+
+TEST(gl_basic, surfaceless_egl_gles2_rgb)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2);
+}
+
+TEST(gl_basic, surfaceless_egl_gles2_rgba)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .alpha=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gles2_no_error)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .no_error=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gles2_no_error_debug_bad_attribute)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .no_error=true,
+                  .debug=true,
+                  .expect_error=WAFFLE_ERROR_BAD_ATTRIBUTE);
+}
+
+TEST(gl_basic, surfaceless_egl_gles2_release_none)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .release_behavior=WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE);
+}
+
+TEST(gl_basic, surfaceless_egl_gles2_priority_low)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .priority=WAFFLE_CONTEXT_PRIORITY_LOW);
+}
+
+TEST(gl_basic, surfaceless_egl_gles2_mutable_render_buffer)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .mutable_render_buffer=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gles2_no_config)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .no_config=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gl_no_config)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .no_config=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gles2_current_state)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .current_state=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gl_dl_sym_array)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .dl_sym_array=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gles2_gl_dispatch)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .gl_dispatch=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gles2_swap_interval)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .swap_interval=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gles2_damage)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .damage=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gles3_readback)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES3,
+                  .readback=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gles3_fence)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES3,
+                  .fence=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gles1_capture)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES1,
+                  .capture=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gles3_capture)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES3,
+                  .capture=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gles2_select_smallest)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .selection=WAFFLE_CONFIG_SELECTION_SMALLEST);
+}
+
+TEST(gl_basic, surfaceless_egl_gl_rgb565_select_smallest)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .color_format=WAFFLE_COLOR_FORMAT_RGB565,
+                  .selection=WAFFLE_CONFIG_SELECTION_SMALLEST);
+}
+
+TEST(gl_basic, surfaceless_egl_gles2_rgb565)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .color_format=WAFFLE_COLOR_FORMAT_RGB565);
+}
+
+TEST(gl_basic, surfaceless_egl_gles2_rgb10_a2)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .color_format=WAFFLE_COLOR_FORMAT_RGB10_A2);
+}
+
+TEST(gl_basic, surfaceless_egl_gles20)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .version=20);
+}
+
+TEST(gl_basic, surfaceless_egl_gles2_fwdcompat_bad_attribute)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .forward_compatible=true,
+                  .expect_error=WAFFLE_ERROR_BAD_ATTRIBUTE);
+}
+
+TEST(gl_basic, surfaceless_egl_gles3_rgb)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES3);
+}
+
+TEST(gl_basic, surfaceless_egl_gles3_rgba)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES3,
+                  .alpha=true);
+}
+
+TEST(gl_basic, surfaceless_egl_gles30)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES3,
+                  .version=30);
+}
+
+TEST(gl_basic, surfaceless_egl_gles3_fwdcompat_bad_attribute)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES3,
+                  .forward_compatible=true,
+                  .expect_error=WAFFLE_ERROR_BAD_ATTRIBUTE);
+}
+
+static void
+testsuite_surfaceless_egl(void)
+{
+    TEST_RUN(gl_basic, surfaceless_egl_init);
+
+    TEST_RUN(gl_basic, surfaceless_egl_gl_rgb);
+    TEST_RUN(gl_basic, surfaceless_egl_gl_rgba);
+    TEST_RUN(gl_basic, surfaceless_egl_gl_debug);
+    TEST_RUN(gl_basic, surfaceless_egl_gl_fwdcompat_bad_attribute);
+
+    TEST_RUN(gl_basic, surfaceless_egl_gl10);
+    TEST_RUN(gl_basic, surfaceless_egl_gl11);
+    TEST_RUN(gl_basic, surfaceless_egl_gl12);
+    TEST_RUN(gl_basic, surfaceless_egl_gl13);
+    TEST_RUN(gl_basic, surfaceless_egl_gl14);
+    TEST_RUN(gl_basic, surfaceless_egl_gl15);
+    TEST_RUN(gl_basic, surfaceless_egl_gl20);
+    TEST_RUN(gl_basic, surfaceless_egl_gl21);
+    TEST_RUN(gl_basic, surfaceless_egl_gl21_fwdcompat_bad_attribute);
+    TEST_RUN(gl_basic, surfaceless_egl_gl30);
+    TEST_RUN(gl_basic, surfaceless_egl_gl30_fwdcompat);
+    TEST_RUN(gl_basic, surfaceless_egl_gl31);
+    TEST_RUN(gl_basic, surfaceless_egl_gl31_fwdcompat);
+
+    TEST_RUN(gl_basic, surfaceless_egl_gl32_core);
+    TEST_RUN(gl_basic, surfaceless_egl_gl32_core_fwdcompat);
+    TEST_RUN(gl_basic, surfaceless_egl_gl33_core);
+    TEST_RUN(gl_basic, surfaceless_egl_gl40_core);
+    TEST_RUN(gl_basic, surfaceless_egl_gl41_core);
+    TEST_RUN(gl_basic, surfaceless_egl_gl42_core);
+    TEST_RUN(gl_basic, surfaceless_egl_gl43_core);
+
+    TEST_RUN(gl_basic, surfaceless_egl_gl32_compat);
+    TEST_RUN(gl_basic, surfaceless_egl_gl33_compat);
+    TEST_RUN(gl_basic, surfaceless_egl_gl40_compat);
+    TEST_RUN(gl_basic, surfaceless_egl_gl41_compat);
+    TEST_RUN(gl_basic, surfaceless_egl_gl42_compat);
+    TEST_RUN(gl_basic, surfaceless_egl_gl43_compat);
+
+    TEST_RUN(gl_basic, surfaceless_egl_gles1_rgb);
+    TEST_RUN(gl_basic, surfaceless_egl_gles1_rgba);
+    TEST_RUN(gl_basic, surfaceless_egl_gles1_fwdcompat_bad_attribute);
+    TEST_RUN(gl_basic, surfaceless_egl_gles1_capture);
+
+    TEST_RUN(gl_basic, surfaceless_egl_gles10);
+    TEST_RUN(gl_basic, surfaceless_egl_gles11);
+
+    TEST_RUN(gl_basic, surfaceless_egl_gles2_rgb);
+    TEST_RUN(gl_basic, surfaceless_egl_gles2_rgba);
+    TEST_RUN(gl_basic, surfaceless_egl_gles2_rgb565);
+    TEST_RUN(gl_basic, surfaceless_egl_gles2_rgb10_a2);
+    TEST_RUN(gl_basic, surfaceless_egl_gles2_no_error);
+    TEST_RUN(gl_basic, surfaceless_egl_gles2_no_error_debug_bad_attribute);
+    TEST_RUN(gl_basic, surfaceless_egl_gles2_release_none);
+    TEST_RUN(gl_basic, surfaceless_egl_gles2_priority_low);
+    TEST_RUN(gl_basic, surfaceless_egl_gles2_mutable_render_buffer);
+    TEST_RUN(gl_basic, surfaceless_egl_gles2_no_config);
+    TEST_RUN(gl_basic, surfaceless_egl_gl_no_config);
+    TEST_RUN(gl_basic, surfaceless_egl_gles2_current_state);
+    TEST_RUN(gl_basic, surfaceless_egl_gl_dl_sym_array);
+    TEST_RUN(gl_basic, surfaceless_egl_gles2_gl_dispatch);
+    TEST_RUN(gl_basic, surfaceless_egl_gles2_swap_interval);
+    TEST_RUN(gl_basic, surfaceless_egl_gles2_damage);
+    TEST_RUN(gl_basic, surfaceless_egl_gles3_readback);
+    TEST_RUN(gl_basic, surfaceless_egl_gles3_fence);
+    TEST_RUN(gl_basic, surfaceless_egl_gles2_select_smallest);
+    TEST_RUN(gl_basic, surfaceless_egl_gl_rgb565_select_smallest);
+    TEST_RUN(gl_basic, surfaceless_egl_gles2_fwdcompat_bad_attribute);
+
+    TEST_RUN(gl_basic, surfaceless_egl_gles20);
+
+    TEST_RUN(gl_basic, surfaceless_egl_gles3_rgb);
+    TEST_RUN(gl_basic, surfaceless_egl_gles3_rgba);
+    TEST_RUN(gl_basic, surfaceless_egl_gles3_fwdcompat_bad_attribute);
+    TEST_RUN(gl_basic, surfaceless_egl_gles3_capture);
+
+    TEST_RUN(gl_basic, surfaceless_egl_gles30);
+}
+#endif // WAFFLE_HAS_SURFACELESS_EGL
+
+#ifdef WAFFLE_HAS_DEVICE_EGL
+TEST(gl_basic, device_egl_init)
+{
+    gl_basic_init(WAFFLE_PLATFORM_DEVICE_EGL);
+}
+
+TEST(gl_basic, device_egl_enumerate)
+{
+    int32_t count = waffle_device_count();
+    struct waffle_display *dpy;
+
+    ASSERT_TRUE(count > 0);
+
+    for (int32_t i = 0; i < count; ++i) {
+        const struct waffle_device_info *info = waffle_device_get_info(i);
+        char name[16];
+
+        ASSERT_TRUE(info != NULL);
+        ASSERT_TRUE(info->index == i);
+
+        snprintf(name, sizeof(name), "%d", i);
+        ASSERT_TRUE(dpy = waffle_display_connect(name));
+        ASSERT_TRUE(waffle_display_disconnect(dpy));
+    }
+
+    ASSERT_TRUE(waffle_device_get_info(count) == NULL);
+    ASSERT_TRUE(waffle_error_get_code() == WAFFLE_ERROR_BAD_PARAMETER);
+}
+
+TEST(gl_basic, device_egl_gl_rgb)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL);
+}
+
+TEST(gl_basic, device_egl_gl_rgba)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .alpha=true);
+}
+
+TEST(gl_basic, device_egl_gl_debug)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .debug=true);
+}
+
+TEST(gl_basic, device_egl_gl_fwdcompat_bad_attribute)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .forward_compatible=true,
+                  .expect_error=WAFFLE_ERROR_BAD_ATTRIBUTE);
+}
+
+TEST(gl_basic, device_egl_gl10)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=10);
+}
+
+TEST(gl_basic, device_egl_gl11)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=11);
+}
+
+TEST(gl_basic, device_egl_gl12)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=12);
+}
+
+TEST(gl_basic, device_egl_gl13)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=13);
+}
+
+TEST(gl_basic, device_egl_gl14)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=14);
+}
+
+TEST(gl_basic, device_egl_gl15)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=15);
+}
+
+TEST(gl_basic, device_egl_gl20)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=20);
+}
+
+TEST(gl_basic, device_egl_gl21)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=21);
+}
+
+TEST(gl_basic, device_egl_gl21_fwdcompat_bad_attribute)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=21,
+                  .forward_compatible=true,
+                  .expect_error=WAFFLE_ERROR_BAD_ATTRIBUTE);
+}
+
+TEST(gl_basic, device_egl_gl30)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=30);
+}
+
+TEST(gl_basic, device_egl_gl30_fwdcompat)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=30,
+                  .forward_compatible=true);
+}
+
+TEST(gl_basic, device_egl_gl31)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=31);
+}
+
+TEST(gl_basic, device_egl_gl31_fwdcompat)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=31,
+                  .forward_compatible=true);
+}
+
+TEST(gl_basic, device_egl_gl32_core)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=32,
+                  .profile=WAFFLE_CONTEXT_CORE_PROFILE);
+}
+
+TEST(gl_basic, device_egl_gl32_core_fwdcompat)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=32,
+                  .profile=WAFFLE_CONTEXT_CORE_PROFILE,
+                  .forward_compatible=true);
+}
+
+TEST(gl_basic, device_egl_gl33_core)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=33,
+                  .profile=WAFFLE_CONTEXT_CORE_PROFILE);
+}
+
+TEST(gl_basic, device_egl_gl40_core)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=40,
+                  .profile=WAFFLE_CONTEXT_CORE_PROFILE);
+}
+
+TEST(gl_basic, device_egl_gl41_core)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=41,
+                  .profile=WAFFLE_CONTEXT_CORE_PROFILE);
+}
+
+TEST(gl_basic, device_egl_gl42_core)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=42,
+                  .profile=WAFFLE_CONTEXT_CORE_PROFILE);
+}
+
+TEST(gl_basic, device_egl_gl43_core)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=43,
+                  .profile=WAFFLE_CONTEXT_CORE_PROFILE);
+}
+
+TEST(gl_basic, device_egl_gl32_compat)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=32,
+                  .profile=WAFFLE_CONTEXT_COMPATIBILITY_PROFILE);
+}
+
+TEST(gl_basic, device_egl_gl33_compat)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=33,
+                  .profile=WAFFLE_CONTEXT_COMPATIBILITY_PROFILE);
+}
+
+TEST(gl_basic, device_egl_gl40_compat)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=40,
+                  .profile=WAFFLE_CONTEXT_COMPATIBILITY_PROFILE);
+}
+
+TEST(gl_basic, device_egl_gl41_compat)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=41,
+                  .profile=WAFFLE_CONTEXT_COMPATIBILITY_PROFILE);
+}
+
+TEST(gl_basic, device_egl_gl42_compat)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=42,
+                  .profile=WAFFLE_CONTEXT_COMPATIBILITY_PROFILE);
+}
+
+TEST(gl_basic, device_egl_gl43_compat)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .version=43,
+                  .profile=WAFFLE_CONTEXT_COMPATIBILITY_PROFILE);
+}
+
+TEST(gl_basic, device_egl_gles1_rgb)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES1);
+}
+
+TEST(gl_basic, device_egl_gles1_rgba)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES1,
+                  .alpha=true);
+}
+
+TEST(gl_basic, device_egl_gles10)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES1,
+                  .version=10,
+                  .alpha=true);
+}
+
+TEST(gl_basic, device_egl_gles11)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES1,
+                  .version=11,
+                  .alpha=true);
+}
+
+TEST(gl_basic, device_egl_gles1_fwdcompat_bad_attribute)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES1,
+                  .forward_compatible=true,
+                  .expect_error=WAFFLE_ERROR_BAD_ATTRIBUTE);
+}
+
+TEST(gl_basic, device_egl_gles2_rgb)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2);
+}
+
+TEST(gl_basic, device_egl_gles2_rgba)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .alpha=true);
+}
+
+TEST(gl_basic, device_egl_gles2_no_error)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .no_error=true);
+}
+
+TEST(gl_basic, device_egl_gles2_no_error_debug_bad_attribute)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .no_error=true,
+                  .debug=true,
+                  .expect_error=WAFFLE_ERROR_BAD_ATTRIBUTE);
+}
+
+TEST(gl_basic, device_egl_gles2_release_none)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .release_behavior=WAFFLE_CONTEXT_RELEASE_BEHAVIOR_NONE);
+}
+
+TEST(gl_basic, device_egl_gles2_priority_low)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .priority=WAFFLE_CONTEXT_PRIORITY_LOW);
+}
+
+TEST(gl_basic, device_egl_gles2_mutable_render_buffer)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .mutable_render_buffer=true);
+}
+
+TEST(gl_basic, device_egl_gles2_no_config)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .no_config=true);
+}
+
+TEST(gl_basic, device_egl_gl_no_config)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .no_config=true);
+}
+
+TEST(gl_basic, device_egl_gles2_current_state)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .current_state=true);
+}
+
+TEST(gl_basic, device_egl_gl_dl_sym_array)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .dl_sym_array=true);
+}
+
+TEST(gl_basic, device_egl_gles2_gl_dispatch)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .gl_dispatch=true);
+}
+
+TEST(gl_basic, device_egl_gles2_swap_interval)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .swap_interval=true);
+}
+
+TEST(gl_basic, device_egl_gles2_damage)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .damage=true);
+}
+
+TEST(gl_basic, device_egl_gles3_readback)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES3,
+                  .readback=true);
+}
+
+TEST(gl_basic, device_egl_gles3_fence)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES3,
+                  .fence=true);
+}
+
+TEST(gl_basic, device_egl_gles1_capture)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES1,
+                  .capture=true);
+}
+
+TEST(gl_basic, device_egl_gles3_capture)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES3,
+                  .capture=true);
+}
+
+TEST(gl_basic, device_egl_gles2_select_smallest)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .selection=WAFFLE_CONFIG_SELECTION_SMALLEST);
+}
+
+TEST(gl_basic, device_egl_gl_rgb565_select_smallest)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL,
+                  .color_format=WAFFLE_COLOR_FORMAT_RGB565,
+                  .selection=WAFFLE_CONFIG_SELECTION_SMALLEST);
+}
+
+TEST(gl_basic, device_egl_gles2_rgb565)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .color_format=WAFFLE_COLOR_FORMAT_RGB565);
+}
+
+TEST(gl_basic, device_egl_gles2_rgb10_a2)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .color_format=WAFFLE_COLOR_FORMAT_RGB10_A2);
+}
+
+TEST(gl_basic, device_egl_gles20)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .version=20);
+}
+
+TEST(gl_basic, device_egl_gles2_fwdcompat_bad_attribute)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES2,
+                  .forward_compatible=true,
+                  .expect_error=WAFFLE_ERROR_BAD_ATTRIBUTE);
+}
+
+TEST(gl_basic, device_egl_gles3_rgb)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES3);
+}
+
+TEST(gl_basic, device_egl_gles3_rgba)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES3,
+                  .alpha=true);
+}
+
+TEST(gl_basic, device_egl_gles30)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES3,
+                  .version=30);
+}
+
+TEST(gl_basic, device_egl_gles3_fwdcompat_bad_attribute)
+{
+    gl_basic_draw(.api=WAFFLE_CONTEXT_OPENGL_ES3,
+                  .forward_compatible=true,
+                  .expect_error=WAFFLE_ERROR_BAD_ATTRIBUTE);
+}
+
+static void
+testsuite_device_egl(void)
+{
+    TEST_RUN(gl_basic, device_egl_init);
+    TEST_RUN(gl_basic, device_egl_enumerate);
+
+    TEST_RUN(gl_basic, device_egl_gl_rgb);
+    TEST_RUN(gl_basic, device_egl_gl_rgba);
+    TEST_RUN(gl_basic, device_egl_gl_debug);
+    TEST_RUN(gl_basic, device_egl_gl_fwdcompat_bad_attribute);
+
+    TEST_RUN(gl_basic, device_egl_gl10);
+    TEST_RUN(gl_basic, device_egl_gl11);
+    TEST_RUN(gl_basic, device_egl_gl12);
+    TEST_RUN(gl_basic, device_egl_gl13);
+    TEST_RUN(gl_basic, device_egl_gl14);
+    TEST_RUN(gl_basic, device_egl_gl15);
+    TEST_RUN(gl_basic, device_egl_gl20);
+    TEST_RUN(gl_basic, device_egl_gl21);
+    TEST_RUN(gl_basic, device_egl_gl21_fwdcompat_bad_attribute);
+    TEST_RUN(gl_basic, device_egl_gl30);
+    TEST_RUN(gl_basic, device_egl_gl30_fwdcompat);
+    TEST_RUN(gl_basic, device_egl_gl31);
+    TEST_RUN(gl_basic, device_egl_gl31_fwdcompat);
+
+    TEST_RUN(gl_basic, device_egl_gl32_core);
+    TEST_RUN(gl_basic, device_egl_gl32_core_fwdcompat);
+    TEST_RUN(gl_basic, device_egl_gl33_core);
+    TEST_RUN(gl_basic, device_egl_gl40_core);
+    TEST_RUN(gl_basic, device_egl_gl41_core);
+    TEST_RUN(gl_basic, device_egl_gl42_core);
+    TEST_RUN(gl_basic, device_egl_gl43_core);
+
+    TEST_RUN(gl_basic, device_egl_gl32_compat);
+    TEST_RUN(gl_basic, device_egl_gl33_compat);
+    TEST_RUN(gl_basic, device_egl_gl40_compat);
+    TEST_RUN(gl_basic, device_egl_gl41_compat);
+    TEST_RUN(gl_basic, device_egl_gl42_compat);
+    TEST_RUN(gl_basic, device_egl_gl43_compat);
+
+    TEST_RUN(gl_basic, device_egl_gles1_rgb);
+    TEST_RUN(gl_basic, device_egl_gles1_rgba);
+    TEST_RUN(gl_basic, device_egl_gles1_fwdcompat_bad_attribute);
+    TEST_RUN(gl_basic, device_egl_gles1_capture);
+
+    TEST_RUN(gl_basic, device_egl_gles10);
+    TEST_RUN(gl_basic, device_egl_gles11);
+
+    TEST_RUN(gl_basic, device_egl_gles2_rgb);
+    TEST_RUN(gl_basic, device_egl_gles2_rgba);
+    TEST_RUN(gl_basic, device_egl_gles2_rgb565);
+    TEST_RUN(gl_basic, device_egl_gles2_rgb10_a2);
+    TEST_RUN(gl_basic, device_egl_gles2_no_error);
+    TEST_RUN(gl_basic, device_egl_gles2_no_error_debug_bad_attribute);
+    TEST_RUN(gl_basic, device_egl_gles2_release_none);
+    TEST_RUN(gl_basic, device_egl_gles2_priority_low);
+    TEST_RUN(gl_basic, device_egl_gles2_mutable_render_buffer);
+    TEST_RUN(gl_basic, device_egl_gles2_no_config);
+    TEST_RUN(gl_basic, device_egl_gl_no_config);
+    TEST_RUN(gl_basic, device_egl_gles2_current_state);
+    TEST_RUN(gl_basic, device_egl_gl_dl_sym_array);
+    TEST_RUN(gl_basic, device_egl_gles2_gl_dispatch);
+    TEST_RUN(gl_basic, device_egl_gles2_swap_interval);
+    TEST_RUN(gl_basic, device_egl_gles2_damage);
+    TEST_RUN(gl_basic, device_egl_gles3_readback);
+    TEST_RUN(gl_basic, device_egl_gles3_fence);
+    TEST_RUN(gl_basic, device_egl_gles2_select_smallest);
+    TEST_RUN(gl_basic, device_egl_gl_rgb565_select_smallest);
+    TEST_RUN(gl_basic, device_egl_gles2_fwdcompat_bad_attribute);
+
+    TEST_RUN(gl_basic, device_egl_gles20);
+
+    TEST_RUN(gl_basic, device_egl_gles3_rgb);
+    TEST_RUN(gl_basic, device_egl_gles3_rgba);
+    TEST_RUN(gl_basic, device_egl_gles3_fwdcompat_bad_attribute);
+    TEST_RUN(gl_basic, device_egl_gles3_capture);
+
+    TEST_RUN(gl_basic, device_egl_gles30);
+}
+#endif // WAFFLE_HAS_DEVICE_EGL
+
+static void
+usage_error(void)
+{
+    fprintf(stderr, "gl_basic_test: usage error\n");
+    exit(1);
+}
+
+/// Run the testsuite in a separate process. If the testsuite fails, then exit
+/// immediately.
+static void
+run_testsuite(void (*testsuite)(void))
+{
+    pid_t pid = fork();
+    int status;
+
+    if (pid > 0) {
+        waitpid(pid, &status, 0);
+        int exit_status = WEXITSTATUS(status);
+        // exit_status is number of failures.
+        if (exit_status == 0) {
+            // All tests passed.
+            return;
+        }
+        else if (exit_status > 0) {
+            // Some tests failed. Don't run any more tests.
+            exit(exit_status);
+        }
+        else {
+            fprintf(stderr, "gl_basic_test: error: child process aborted\n");
+            abort();
+        }
+    }
+    else if (pid == 0) {
+        #ifdef __APPLE__
+            gl_basic_cocoa_init();
+        #endif
+
+        void (*testsuites[])(void) = {testsuite, 0};
+        int argc = 0;
+        int num_failures = wt_main(&argc, NULL, testsuites);
+
+        #ifdef __APPLE__
+            gl_basic_cocoa_finish();
+        #endif
+
+        exit(num_failures);
+    }
+    else {
+        fprintf(stderr, "gl_basic_test: error: fork failed\n");
+        abort();
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    if (argc != 1)
+        usage_error();
+
+#ifdef WAFFLE_HAS_CGL
+    run_testsuite(testsuite_cgl);
+#endif
+#ifdef WAFFLE_HAS_GLX
+    run_testsuite(testsuite_glx);
+#endif
+#ifdef WAFFLE_HAS_WAYLAND
+    run_testsuite(testsuite_wayland);
+#endif
+#ifdef WAFFLE_HAS_X11_EGL
+    run_testsuite(testsuite_x11_egl);
+#endif
+#ifdef WAFFLE_HAS_GBM
+    run_testsuite(testsuite_gbm);
+#endif
+#ifdef WAFFLE_HAS_SURFACELESS_EGL
+    run_testsuite(testsuite_surfaceless_egl);
+#endif
+#ifdef WAFFLE_HAS_DEVICE_EGL
+    run_testsuite(testsuite_device_egl);
 #endif
 
    return 0;